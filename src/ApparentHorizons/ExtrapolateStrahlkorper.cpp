@@ -0,0 +1,63 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
+
+#include <deque>
+#include <utility>
+
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+/// \endcond
+
+namespace ah {
+template <typename Frame>
+Strahlkorper<Frame> extrapolate_strahlkorper(
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    const double time) noexcept {
+  ASSERT(not previous_strahlkorpers.empty(),
+         "Need at least one previous surface to extrapolate from.");
+  const auto& latest = previous_strahlkorpers.front().second;
+  size_t number_of_points = 0;
+  for (const auto& time_and_strahlkorper : previous_strahlkorpers) {
+    const auto& strahlkorper = time_and_strahlkorper.second;
+    if (strahlkorper.l_max() != latest.l_max() or
+        strahlkorper.m_max() != latest.m_max() or
+        strahlkorper.center() != latest.center()) {
+      break;
+    }
+    ++number_of_points;
+  }
+
+  DataVector coefs(latest.coefficients().size(), 0.0);
+  for (size_t j = 0; j < number_of_points; ++j) {
+    // The Lagrange polynomial through the times of the surfaces that is one
+    // at the time of surface `j`
+    const double time_j = previous_strahlkorpers[j].first;
+    double weight = 1.0;
+    for (size_t m = 0; m < number_of_points; ++m) {
+      if (m != j) {
+        const double time_m = previous_strahlkorpers[m].first;
+        ASSERT(time_m != time_j,
+               "Cannot extrapolate from two surfaces at the same time "
+                   << time_j);
+        weight *= (time - time_m) / (time_j - time_m);
+      }
+    }
+    coefs += weight * previous_strahlkorpers[j].second.coefficients();
+  }
+  return Strahlkorper<Frame>(std::move(coefs), latest);
+}
+
+template Strahlkorper<Frame::Inertial> extrapolate_strahlkorper(
+    const std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>&
+        previous_strahlkorpers,
+    const double time) noexcept;
+}  // namespace ah
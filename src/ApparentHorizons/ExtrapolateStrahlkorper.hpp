@@ -0,0 +1,36 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+/// \cond
+template <typename Frame>
+class Strahlkorper;
+/// \endcond
+
+namespace ah {
+/// The number of previously found horizons kept to extrapolate the initial
+/// guess of the next horizon find, so the extrapolation is quadratic in time.
+constexpr size_t number_of_previous_strahlkorpers = 3;
+
+/*!
+ * \ingroup SurfacesGroup
+ * \brief Extrapolate previously found surfaces to `time`, as the initial guess
+ * for the next horizon find.
+ *
+ * \details `previous_strahlkorpers` holds the times and surfaces of the
+ * previous finds, the most recent first. The spectral coefficients are
+ * extrapolated with a Lagrange polynomial in time through the most recent
+ * surface and the consecutive older ones that have the same resolution and
+ * center. With a single previous surface, that surface is returned.
+ */
+template <typename Frame>
+Strahlkorper<Frame> extrapolate_strahlkorper(
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    double time) noexcept;
+}  // namespace ah
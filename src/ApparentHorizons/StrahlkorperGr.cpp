@@ -87,23 +87,28 @@ tnsr::I<DataVector, 2, Frame::Spherical<Fr>> get_trace_christoffel_second_kind(
   // reimplement this code to avoid dividing by sin(theta).
   //
   // Note: YlmSpherepack gradients are flat-space Pfaffian derivatives.
-  auto grad_surface_metric_theta_theta =
-      ylm.gradient(square(get(sin_theta)) * get<0, 0>(surface_metric));
+  const DataVector sin_theta_squared_metric_theta_theta =
+      square(get(sin_theta)) * get<0, 0>(surface_metric);
+  const DataVector sin_theta_metric_theta_phi =
+      get(sin_theta) * get<0, 1>(surface_metric);
+  // Compute the three gradients together.
+  auto gradients = ylm.gradients<3>({{&sin_theta_squared_metric_theta_theta,
+                                      &sin_theta_metric_theta_phi,
+                                      &get<1, 1>(surface_metric)}});
+  auto& grad_surface_metric_theta_theta = gradients[0];
+  auto& grad_surface_metric_theta_phi = gradients[1];
+  const auto& grad_surface_metric_phi_phi = gradients[2];
+
   get<0>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
   get<1>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
   get<0>(grad_surface_metric_theta_theta) -=
       2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_theta_phi =
-      ylm.gradient(get(sin_theta) * get<0, 1>(surface_metric));
-
   get<0>(grad_surface_metric_theta_phi) /= get(sin_theta);
   get<1>(grad_surface_metric_theta_phi) /= get(sin_theta);
   get<0>(grad_surface_metric_theta_phi) -=
       get<0, 1>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_phi_phi = ylm.gradient(get<1, 1>(surface_metric));
-
   auto deriv_surface_metric =
       make_with_value<tnsr::ijj<DataVector, 2, Frame::Spherical<Fr>>>(
           get<0, 0>(surface_metric), 0.0);
@@ -710,11 +715,12 @@ void spin_function(
   get(extrinsic_curvature_theta_normal_sin_theta) *= sin_theta;
   get(extrinsic_curvature_phi_normal) *= sin_theta;
 
-  // now computing actual result
-  get(*result) =
-      (get<0>(ylm.gradient(get(extrinsic_curvature_phi_normal))) -
-       get<1>(ylm.gradient(get(extrinsic_curvature_theta_normal_sin_theta)))) /
-      (sin_theta * get(area_element));
+  // now computing actual result, with both gradients computed together
+  const auto gradients =
+      ylm.gradients<2>({{&get(extrinsic_curvature_phi_normal),
+                         &get(extrinsic_curvature_theta_normal_sin_theta)}});
+  get(*result) = (get<0>(gradients[0]) - get<1>(gradients[1])) /
+                 (sin_theta * get(area_element));
 }
 
 template <typename Frame>
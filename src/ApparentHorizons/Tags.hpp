@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <deque>
 #include <string>
+#include <utility>
 
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/StrahlkorperGr.hpp"
@@ -30,6 +32,14 @@ namespace Tags {
 struct FastFlow : db::SimpleTag {
   using type = ::FastFlow;
 };
+
+/// The times and surfaces of the previous horizon finds, the most recent
+/// first, used to extrapolate the initial guess of the next find (see
+/// `ah::extrapolate_strahlkorper`).
+template <typename Frame>
+struct PreviousStrahlkorpers : db::SimpleTag {
+  using type = std::deque<std::pair<double, ::Strahlkorper<Frame>>>;
+};
 }  // namespace Tags
 }  // namespace ah
 
@@ -4,6 +4,7 @@
 #include "ApparentHorizons/YlmSpherepack.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ostream>
 #include <tuple>
@@ -306,6 +307,43 @@ YlmSpherepack::FirstDeriv YlmSpherepack::gradient_from_coefs_all_offsets(
   return result;
 }
 
+template <size_t NumberOfFunctions>
+std::array<YlmSpherepack::FirstDeriv, NumberOfFunctions>
+YlmSpherepack::gradients(const std::array<const DataVector*, NumberOfFunctions>&
+                             collocation_values) const noexcept {
+  const size_t size = physical_size();
+  auto& interleaved_values = memory_pool_.get(NumberOfFunctions * size);
+  for (size_t f = 0; f < NumberOfFunctions; ++f) {
+    const DataVector& values = *gsl::at(collocation_values, f);
+    ASSERT(values.size() == size,
+           "Sizes don't match: " << values.size() << " vs " << size);
+    for (size_t s = 0; s < size; ++s) {
+      interleaved_values[s * NumberOfFunctions + f] = values[s];
+    }
+  }
+  const std::array<double*, 2> interleaved_df{
+      {memory_pool_.get(NumberOfFunctions * size).data(),
+       memory_pool_.get(NumberOfFunctions * size).data()}};
+  gradient_all_offsets(interleaved_df, interleaved_values.data(),
+                       NumberOfFunctions);
+  memory_pool_.free(interleaved_values);
+
+  std::array<FirstDeriv, NumberOfFunctions> result{};
+  for (size_t f = 0; f < NumberOfFunctions; ++f) {
+    auto& df = gsl::at(result, f);
+    df = FirstDeriv(size);
+    for (size_t d = 0; d < 2; ++d) {
+      for (size_t s = 0; s < size; ++s) {
+        df.get(d)[s] = gsl::at(interleaved_df, d)[s * NumberOfFunctions + f];
+      }
+    }
+  }
+  for (size_t d = 0; d < 2; ++d) {
+    memory_pool_.free(gsl::at(interleaved_df, d));
+  }
+  return result;
+}
+
 /// \cond DOXYGEN_FAILS_TO_PARSE_THIS
 void YlmSpherepack::scalar_laplacian(
     const gsl::not_null<double*> scalar_laplacian,
@@ -457,56 +495,51 @@ void YlmSpherepack::second_derivative(
 
   // Now get Cartesian derivatives.
 
-  // First derivative
-  std::vector<double*> dfc(3, nullptr);
-  for (size_t i = 0; i < 3; ++i) {
-    dfc[i] = memory_pool_.get(physical_size()).data();
-  }
+  // First derivative.  The three Cartesian components are interleaved
+  // so that their gradients are computed in a single SPHEREPACK call.
+  auto& dfc = memory_pool_.get(3 * physical_size());
   for (size_t j = 0, s = 0; j < n_phi_; ++j) {
     for (size_t i = 0; i < n_theta_; ++i, ++s) {
-      dfc[0][s] = cos_theta[i] * cos_phi[j] *
-                      df[0][s * physical_stride + physical_offset] -
-                  sin_phi[j] * df[1][s * physical_stride + physical_offset];
-      dfc[1][s] = cos_theta[i] * sin_phi[j] *
-                      df[0][s * physical_stride + physical_offset] +
-                  cos_phi[j] * df[1][s * physical_stride + physical_offset];
-      dfc[2][s] = -sin_theta[i] * df[0][s * physical_stride + physical_offset];
+      dfc[3 * s] = cos_theta[i] * cos_phi[j] *
+                       df[0][s * physical_stride + physical_offset] -
+                   sin_phi[j] * df[1][s * physical_stride + physical_offset];
+      dfc[3 * s + 1] =
+          cos_theta[i] * sin_phi[j] *
+              df[0][s * physical_stride + physical_offset] +
+          cos_phi[j] * df[1][s * physical_stride + physical_offset];
+      dfc[3 * s + 2] =
+          -sin_theta[i] * df[0][s * physical_stride + physical_offset];
     }
   }
 
   // Take derivatives of Cartesian derivatives to get second derivatives.
-  std::vector<std::array<double*, 2>> ddfc(3, {{nullptr, nullptr}});
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j < 2; ++j) {
-      gsl::at(ddfc[i], j) = memory_pool_.get(physical_size()).data();
-    }
-    gradient(ddfc[i], dfc[i], 1, 0);
-    // Here we free the storage for dfc[i], so we can reuse it in ddfc.
-    memory_pool_.free(dfc[i]);
-  }
+  // ddfc[j][3 * s + i] is the jth Pfaffian derivative of dfc[i] at point s.
+  const std::array<double*, 2> ddfc{
+      {memory_pool_.get(3 * physical_size()).data(),
+       memory_pool_.get(3 * physical_size()).data()}};
+  gradient_all_offsets(ddfc, dfc.data(), 3);
+  memory_pool_.free(dfc);
 
   // Combine into Pfaffian second derivatives
   for (size_t j = 0, s = 0; j < n_phi_; ++j) {
     for (size_t i = 0; i < n_theta_; ++i, ++s) {
       ddf->get(1, 0)[s * physical_stride + physical_offset] =
-          -ddfc[2][1][s] * cosec_theta[i];
+          -ddfc[1][3 * s + 2] * cosec_theta[i];
       ddf->get(0, 1)[s * physical_stride + physical_offset] =
           ddf->get(1, 0)[s * physical_stride + physical_offset] -
           cot_theta[i] * df[1][s * physical_stride + physical_offset];
       ddf->get(1, 1)[s * physical_stride + physical_offset] =
-          cos_phi[j] * ddfc[1][1][s] - sin_phi[j] * ddfc[0][1][s] -
+          cos_phi[j] * ddfc[1][3 * s + 1] - sin_phi[j] * ddfc[1][3 * s] -
           cot_theta[i] * df[0][s * physical_stride + physical_offset];
       ddf->get(0, 0)[s * physical_stride + physical_offset] =
-          cos_theta[i] *
-              (cos_phi[j] * ddfc[0][0][s] + sin_phi[j] * ddfc[1][0][s]) -
-          sin_theta[i] * ddfc[2][0][s];
+          cos_theta[i] * (cos_phi[j] * ddfc[0][3 * s] +
+                          sin_phi[j] * ddfc[0][3 * s + 1]) -
+          sin_theta[i] * ddfc[0][3 * s + 2];
     }
   }
 
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j < 2; ++j) {
-      memory_pool_.free(gsl::at(ddfc[i], j));
-    }
+  for (size_t j = 0; j < 2; ++j) {
+    memory_pool_.free(gsl::at(ddfc, j));
   }
 }
 
@@ -916,3 +949,7 @@ bool operator!=(const YlmSpherepack& lhs, const YlmSpherepack& rhs) noexcept {
 template void YlmSpherepack::interpolate_from_coefs<std::vector<double>>(
     const gsl::not_null<std::vector<double>*>, const std::vector<double>&,
     const InterpolationInfo&, size_t, size_t) const noexcept;
+template std::array<YlmSpherepack::FirstDeriv, 2> YlmSpherepack::gradients(
+    const std::array<const DataVector*, 2>&) const noexcept;
+template std::array<YlmSpherepack::FirstDeriv, 3> YlmSpherepack::gradients(
+    const std::array<const DataVector*, 3>&) const noexcept;
@@ -211,6 +211,15 @@ class YlmSpherepack {
                                              size_t stride = 1) const noexcept;
   ///@}
 
+  /// Computes the gradients of several functions at once.  The
+  /// functions are interleaved and transformed in a single SPHEREPACK
+  /// call (see `gradient_all_offsets`), which is faster than calling
+  /// `gradient` for each of them.
+  template <size_t NumberOfFunctions>
+  std::array<FirstDeriv, NumberOfFunctions> gradients(
+      const std::array<const DataVector*, NumberOfFunctions>&
+          collocation_values) const noexcept;
+
   /// Computes Laplacian in physical space.
   /// To act on a slice of the input and output arrays, specify stride
   /// and offset (assumed to be the same for input and output).
@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace control_system {
+namespace OptionTags {
+/// \ingroup OptionTagsGroup
+/// \ingroup ControlSystemGroup
+/// How long the elements keep the segments of the functions of time before
+/// the current time
+struct FunctionOfTimeRetention {
+  using type = double;
+  static constexpr OptionString help =
+      "Time before the current time for which the elements keep the segments "
+      "of the functions of time. Older segments are discarded.";
+  static type lower_bound() noexcept { return 0.0; }
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ControlSystemGroup
+/// How long the elements keep the segments of the functions of time before
+/// the current time
+///
+/// \see `control_system::Actions::UpdateFunctionsOfTime`
+struct FunctionOfTimeRetention : db::SimpleTag {
+  using type = double;
+  using option_tags = tmpl::list<OptionTags::FunctionOfTimeRetention>;
+
+  static constexpr bool pass_metavariables = false;
+  static double create_from_options(const double retention) noexcept {
+    return retention;
+  }
+};
+}  // namespace Tags
+}  // namespace control_system
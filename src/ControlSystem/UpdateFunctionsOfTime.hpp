@@ -0,0 +1,209 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "ControlSystem/Tags.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/Tags.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace control_system {
+namespace Tags {
+/// \ingroup ControlSystemGroup
+/// \brief The inbox tag for updates of the functions of time.
+///
+/// The temporal id is the time of the update, and the data holds, for each
+/// updated function of time, the new `MaxDeriv`th derivative and the next
+/// expiration time. See `control_system::send_function_of_time_update`.
+struct FunctionOfTimeUpdates
+    : public Parallel::InboxInserters::Map<FunctionOfTimeUpdates> {
+  using temporal_id = double;
+  using type =
+      std::map<temporal_id,
+               std::unordered_map<std::string, std::pair<DataVector, double>>>;
+};
+}  // namespace Tags
+
+/// \ingroup ControlSystemGroup
+/// \brief Send an update of the function of time `name` to all elements of
+/// `ElementComponent`.
+///
+/// The update must start at the current expiration time of the function of
+/// time and is valid up to `next_expiration_time`. The elements apply it in
+/// `control_system::Actions::UpdateFunctionsOfTime`.
+template <typename ElementComponent, typename Metavariables>
+void send_function_of_time_update(
+    Parallel::ConstGlobalCache<Metavariables>& cache, const std::string& name,
+    const double time_of_update, DataVector updated_max_deriv,
+    const double next_expiration_time) noexcept {
+  Parallel::receive_data<Tags::FunctionOfTimeUpdates>(
+      Parallel::get_parallel_component<ElementComponent>(cache),
+      time_of_update,
+      std::make_pair(name, std::make_pair(std::move(updated_max_deriv),
+                                          next_expiration_time)));
+}
+
+namespace Actions {
+/*!
+ * \ingroup ActionsGroup
+ * \ingroup ControlSystemGroup
+ * \brief Apply the updates of the functions of time received from the control
+ * systems, waiting for them if a function of time has expired.
+ *
+ * \details The control systems send new segments of the functions of time
+ * (see `control_system::send_function_of_time_update`) as they are computed,
+ * each one starting at the expiration time of the previous one. An element
+ * only has to wait for an update if it needs a function of time past its
+ * expiration time, so there is no global synchronization between the control
+ * systems and the elements. Updates may arrive in any order: each one is only
+ * applied once the updates preceding it have been applied. Updates that start
+ * before the current expiration time have already been applied and are
+ * discarded.
+ *
+ * Long evolutions accumulate many segments, so whenever updates are received
+ * the segments that end more than
+ * `control_system::Tags::FunctionOfTimeRetention` before the current time are
+ * discarded.
+ *
+ * This action should be placed before anything that evaluates the functions
+ * of time at the current time, e.g. at the start of the step actions.
+ *
+ * Uses:
+ * - ConstGlobalCache:
+ *   - `control_system::Tags::FunctionOfTimeRetention`
+ * - DataBox:
+ *   - `Tags::Time`
+ *
+ * DataBox changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies:
+ *   - `domain::Tags::FunctionsOfTime`
+ */
+struct UpdateFunctionsOfTime {
+  using inbox_tags = tmpl::list<Tags::FunctionOfTimeUpdates>;
+  using const_global_cache_tags = tmpl::list<Tags::FunctionOfTimeRetention>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    auto& inbox = tuples::get<Tags::FunctionOfTimeUpdates>(inboxes);
+    // Mutating the functions of time resets everything computed from them,
+    // so the DataBox is left alone unless there are updates
+    if (inbox.empty()) {
+      return std::forward_as_tuple(std::move(box));
+    }
+    const double retention_time =
+        db::get<::Tags::Time>(box) -
+        Parallel::get<Tags::FunctionOfTimeRetention>(cache);
+    db::mutate<domain::Tags::FunctionsOfTime>(
+        make_not_null(&box),
+        [&inbox, &retention_time](
+            const gsl::not_null<db::item_type<domain::Tags::FunctionsOfTime>*>
+                functions_of_time) noexcept {
+          // The updates are ordered by time, so a chain of updates of a
+          // function of time is applied in a single pass.
+          for (auto updates_it = inbox.begin(); updates_it != inbox.end();) {
+            const double time_of_update = updates_it->first;
+            auto& updates = updates_it->second;
+            for (auto update_it = updates.begin();
+                 update_it != updates.end();) {
+              auto& function_of_time =
+                  get_function_of_time(functions_of_time, update_it->first);
+              const double expiration_time = function_of_time.expiration_time();
+              if (expiration_time == time_of_update) {
+                function_of_time.update(time_of_update,
+                                        std::move(update_it->second.first),
+                                        update_it->second.second);
+                update_it = updates.erase(update_it);
+              } else if (expiration_time > time_of_update) {
+                // The function of time already covers this update, e.g. if
+                // it was sent more than once, so it will never be applied
+                update_it = updates.erase(update_it);
+              } else {
+                ++update_it;
+              }
+            }
+            if (updates.empty()) {
+              updates_it = inbox.erase(updates_it);
+            } else {
+              ++updates_it;
+            }
+          }
+          // Discard the segments the element no longer needs
+          for (const auto& name_and_function_of_time : *functions_of_time) {
+            name_and_function_of_time.second->truncate_before(retention_time);
+          }
+        });
+    return std::forward_as_tuple(std::move(box));
+  }
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static bool is_ready(
+      const db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/) noexcept {
+    const double time = db::get<::Tags::Time>(box);
+    const auto& inbox = tuples::get<Tags::FunctionOfTimeUpdates>(inboxes);
+    for (const auto& name_and_function_of_time :
+         db::get<domain::Tags::FunctionsOfTime>(box)) {
+      double expiration_time =
+          name_and_function_of_time.second->expiration_time();
+      // Follow the chain of received updates until the current time is
+      // covered
+      auto updates_it = inbox.find(expiration_time);
+      while (expiration_time < time and updates_it != inbox.end()) {
+        const auto update =
+            updates_it->second.find(name_and_function_of_time.first);
+        if (update == updates_it->second.end()) {
+          break;
+        }
+        expiration_time = update->second.second;
+        updates_it = inbox.find(expiration_time);
+      }
+      if (expiration_time < time) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  template <typename FunctionsOfTime>
+  static domain::FunctionsOfTime::FunctionOfTime& get_function_of_time(
+      const gsl::not_null<FunctionsOfTime*> functions_of_time,
+      const std::string& name) noexcept {
+    const auto found = functions_of_time->find(name);
+    if (found == functions_of_time->end()) {
+      ERROR("Received an update for the function of time '"
+            << name << "', which is not one of the functions of time.");
+    }
+    return *found->second;
+  }
+};
+}  // namespace Actions
+}  // namespace control_system
@@ -85,7 +85,7 @@ struct AddSub<T1, T2, ArgsList1<Args1...>, ArgsList2<Args2...>, Sign>
   AddSub(T1 t1, T2 t2) : t1_(std::move(t1)), t2_(std::move(t2)) {}
 
   template <typename... LhsIndices, typename T>
-  SPECTRE_ALWAYS_INLINE type
+  SPECTRE_ALWAYS_INLINE auto
   get(const std::array<T, num_tensor_indices>& tensor_index) const {
     if constexpr (Sign == 1) {
       return t1_.template get<LhsIndices...>(tensor_index) +
@@ -96,7 +96,7 @@ struct AddSub<T1, T2, ArgsList1<Args1...>, ArgsList2<Args2...>, Sign>
     }
   }
 
-  SPECTRE_ALWAYS_INLINE typename T1::type operator[](size_t i) const {
+  SPECTRE_ALWAYS_INLINE auto operator[](size_t i) const {
     if constexpr (Sign == 1) {
       return t1_[i] + t2_[i];
     } else {
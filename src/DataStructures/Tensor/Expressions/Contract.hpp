@@ -46,8 +46,7 @@ using ComputeContractedType = typename ComputeContractedTypeImpl<
 template <int I, typename Index1, typename Index2>
 struct ComputeContractionImpl {
   template <typename... LhsIndices, typename T, typename S>
-  static SPECTRE_ALWAYS_INLINE typename T::type apply(S tensor_index,
-                                                      const T& t1) {
+  static SPECTRE_ALWAYS_INLINE auto apply(S tensor_index, const T& t1) {
     tensor_index[Index1::value] = I;
     tensor_index[Index2::value] = I;
     return t1.template get<LhsIndices...>(tensor_index) +
@@ -59,8 +58,7 @@ struct ComputeContractionImpl {
 template <typename Index1, typename Index2>
 struct ComputeContractionImpl<0, Index1, Index2> {
   template <typename... LhsIndices, typename T, typename S>
-  static SPECTRE_ALWAYS_INLINE typename T::type apply(S tensor_index,
-                                                      const T& t1) {
+  static SPECTRE_ALWAYS_INLINE auto apply(S tensor_index, const T& t1) {
     tensor_index[Index1::value] = 0;
     tensor_index[Index2::value] = 0;
     return t1.template get<LhsIndices...>(tensor_index);
@@ -143,7 +141,7 @@ struct TensorContract
   }
 
   template <typename... LhsIndices, typename U>
-  SPECTRE_ALWAYS_INLINE type
+  SPECTRE_ALWAYS_INLINE auto
   get(const std::array<U, num_tensor_indices>& new_tensor_index) const {
     // new_tensor_index is the one with _fewer_ components, ie post-contraction
     std::array<int, tmpl::size<Symm>::value> tensor_index;
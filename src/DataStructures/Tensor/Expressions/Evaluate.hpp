@@ -2,15 +2,31 @@
 // See LICENSE.txt for details.
 
 /// \file
-/// Defines function TensorExpressions::evaluate(TensorExpression)
+/// Defines functions TensorExpressions::evaluate(TensorExpression)
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
+#include "DataStructures/Tensor/Symmetry.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 
 namespace TensorExpressions {
+namespace detail {
+// The symmetries computed by the expressions are lists of the symmetry values,
+// which need not be in the canonical form used by Tensor
+template <typename SymmList>
+struct CanonicalSymmetry;
+
+template <template <typename...> class SymmList, typename... Symm>
+struct CanonicalSymmetry<SymmList<Symm...>> {
+  using type = Symmetry<Symm::value...>;
+};
+}  // namespace detail
 
 /*!
  * \ingroup TensorExpressionsGroup
@@ -39,4 +55,55 @@ auto evaluate(const T& te) {
       te, tmpl::list<LhsIndices...>{});
 }
 
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Evaluate a Tensor Expression into an existing Tensor with LHS indices
+ * set in the template parameters
+ *
+ * \details
+ * Only the independent components of `lhs_tensor` are computed. Each
+ * component is evaluated from a single expression template of the `DataType`
+ * of the Tensor, so for a `DataVector` the sums, products and contractions
+ * making up a component are fused into one loop over the grid points with no
+ * intermediate allocations. If the components of `lhs_tensor` already have
+ * the correct size they are reused, so no memory is allocated at all.
+ *
+ * \warning `lhs_tensor` must not be one of the Tensors appearing in the
+ * expression, since its components are overwritten while the expression is
+ * being evaluated.
+ *
+ * @tparam LhsIndices the indices on the left hand side of the tensor expression
+ */
+template <typename... LhsIndices, typename X, typename Symm,
+          typename IndexList, typename T,
+          Requires<std::is_base_of<Expression, T>::value> = nullptr>
+void evaluate(const gsl::not_null<Tensor<X, Symm, IndexList>*> lhs_tensor,
+              const T& te) noexcept {
+  static_assert(
+      sizeof...(LhsIndices) == tmpl::size<typename T::args_list>::value,
+      "Must have the same number of indices on the LHS and RHS of a tensor "
+      "equation.");
+  using rhs = tmpl::transform<tmpl::remove_duplicates<typename T::args_list>,
+                              std::decay<tmpl::_1>>;
+  static_assert(
+      tmpl::equal_members<tmpl::list<std::decay_t<LhsIndices>...>, rhs>::value,
+      "All indices on the LHS of a Tensor Expression (that is, those specified "
+      "in evaluate<Indices::...>) must be present on the RHS of the expression "
+      "as well.");
+  static_assert(std::is_same_v<X, typename T::type>,
+                "The data type of the LHS Tensor must match that of the "
+                "Tensor Expression.");
+  static_assert(std::is_same_v<Symm, typename detail::CanonicalSymmetry<
+                                         typename T::symmetry>::type>,
+                "The symmetry of the LHS Tensor must match that of the "
+                "Tensor Expression.");
+  static_assert(std::is_same_v<IndexList, typename T::index_list>,
+                "The indices of the LHS Tensor must match those of the "
+                "Tensor Expression.");
+  for (size_t i = 0; i < lhs_tensor->size(); ++i) {
+    (*lhs_tensor)[i] = te.template get<LhsIndices...>(
+        Tensor<X, Symm, IndexList>::get_tensor_index(i));
+  }
+}
+
 }  // namespace TensorExpressions
@@ -53,7 +53,7 @@ struct Product<T1, T2, ArgsList1<Args1...>, ArgsList2<Args2...>>
   // they need to be reduced together, then split at the correct length so that
   // the indexing is correct.
   template <typename... LhsIndices, typename U>
-  SPECTRE_ALWAYS_INLINE type
+  SPECTRE_ALWAYS_INLINE auto
   get(const std::array<U, num_tensor_indices>& tensor_index) const {
     return t1_.template get<LhsIndices...>(tensor_index) *
            t2_.template get<LhsIndices...>(tensor_index);
@@ -400,11 +400,18 @@ struct TensorExpression<Derived, DataType, Symm, IndexList, ArgsList<Args...>>
   /// end for
   /// \endverbatim
   ///
+  /// The component of a Tensor is returned by reference, so that the
+  /// expressions built on top of it by AddSub, Product and TensorContract are
+  /// unevaluated expression templates of the underlying `DataType`. The
+  /// whole expression for a component is then computed in a single loop over
+  /// the grid points when it is assigned, without any intermediate
+  /// `DataVector`s.
+  ///
   /// \tparam LhsIndices the tensor indices on the LHS on the expression
   /// \param tensor_index the tensor component to retrieve
-  /// \return the value of the DataType of component `tensor_index`
+  /// \return the component `tensor_index`, or an expression computing it
   template <typename... LhsIndices, typename ArrayValueType>
-  SPECTRE_ALWAYS_INLINE type
+  SPECTRE_ALWAYS_INLINE decltype(auto)
   get(const std::array<ArrayValueType, num_tensor_indices>& tensor_index)
       const noexcept {
     if constexpr (tt::is_a_v<Tensor, Derived>) {
@@ -431,7 +438,7 @@ struct TensorExpression<Derived, DataType, Symm, IndexList, ArgsList<Args...>>
   /// Retrieve the i'th entry of the Tensor being held
   template <typename V = Derived,
             Requires<tt::is_a<Tensor, V>::value> = nullptr>
-  SPECTRE_ALWAYS_INLINE type operator[](const size_t i) const {
+  SPECTRE_ALWAYS_INLINE const type& operator[](const size_t i) const {
     return t_->operator[](i);
   }
 
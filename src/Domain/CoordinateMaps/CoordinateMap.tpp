@@ -284,7 +284,8 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::inv_jacobian_impl(
                   std::move(noframe_inv_jac.get(source, target));
             }
           }
-        } else if (LIKELY(not map.is_identity())) {
+        } else if (LIKELY(not map.is_identity()) and
+                   not domain::is_jacobian_identity_v<Map>) {
           detail::get_inv_jacobian(
               make_not_null(&noframe_inv_jac), map, mapped_point, time,
               functions_of_time,
@@ -333,7 +334,8 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::jacobian_impl(
                   std::move(noframe_jac.get(target, source));
             }
           }
-        } else if (LIKELY(not map.is_identity())) {
+        } else if (LIKELY(not map.is_identity()) and
+                   not domain::is_jacobian_identity_v<Map>) {
           detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
                                time, functions_of_time,
                                domain::is_jacobian_time_dependent_t<Map, T>{});
@@ -438,6 +440,19 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
               frame_velocity[i] = make_with_value<T>(get<0, 0>(jac), 0.0);
             }
           }
+        } else if (domain::is_jacobian_identity_v<Map>) {
+          // The Jacobian of the map is the identity, so the accumulated
+          // Jacobians are unchanged and the frame velocity of the map is simply
+          // added to the frame velocity of the previous maps.
+          if (domain::is_map_time_dependent_v<
+                  std::tuple_element_t<count, std::decay_t<decltype(maps)>>>) {
+            const std::array<T, dim> noframe_frame_velocity =
+                detail::get_frame_velocity(map, mapped_point, time,
+                                           functions_of_time);
+            for (size_t i = 0; i < dim; ++i) {
+              frame_velocity.get(i) += gsl::at(noframe_frame_velocity, i);
+            }
+          }
         } else if (LIKELY(not map.is_identity())) {
           // WARNING: we have assumed that if the map is the identity the frame
           // velocity is also zero. That is, we do not optimize for the map
@@ -39,6 +39,9 @@ template <typename Map1, typename Map2>
 class ProductOf2Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim;
+  static constexpr bool jacobian_is_identity =
+      domain::is_jacobian_identity_v<Map1> and
+      domain::is_jacobian_identity_v<Map2>;
   using map_list = tmpl::list<Map1, Map2>;
   static_assert(dim == 2 or dim == 3,
                 "Only 2D and 3D maps are supported by ProductOf2Maps");
@@ -119,6 +122,10 @@ template <typename Map1, typename Map2, typename Map3>
 class ProductOf3Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim + Map3::dim;
+  static constexpr bool jacobian_is_identity =
+      domain::is_jacobian_identity_v<Map1> and
+      domain::is_jacobian_identity_v<Map2> and
+      domain::is_jacobian_identity_v<Map3>;
   using map_list = tmpl::list<Map1, Map2, Map3>;
   static_assert(dim == 3, "Only 3D maps are implemented for ProductOf3Maps");
   static_assert(
@@ -33,10 +33,15 @@ namespace TimeDependent {
  *
  * The map adds a translation, \f$T(t)\f$, to the coordinates \f$\xi\f$,
  * where \f$T(t)\f$ is a FunctionOfTime.
+ *
+ * The Jacobian of the map is the identity at all times, which is advertised
+ * through `jacobian_is_identity` so that `CoordinateMap` can skip computing
+ * and multiplying it when composing maps.
  */
 class Translation {
  public:
   static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_identity = true;
 
   Translation() = default;
   explicit Translation(std::string function_of_time_name) noexcept;
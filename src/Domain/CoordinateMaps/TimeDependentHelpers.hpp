@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 #include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/IsCallable.hpp"
 
@@ -30,6 +31,8 @@ constexpr bool is_map_time_dependent_v = is_map_time_dependent_t<T>::value;
 
 namespace detail {
 CREATE_IS_CALLABLE(jacobian)
+CREATE_HAS_STATIC_MEMBER_VARIABLE(jacobian_is_identity)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(jacobian_is_identity)
 }  // namespace detail
 
 /// Check if the calls to the Jacobian and inverse Jacobian of the coordinate
@@ -45,4 +48,26 @@ using is_jacobian_time_dependent_t = detail::is_jacobian_callable_t<
 template <typename Map, typename T>
 constexpr bool is_jacobian_time_dependent_v =
     is_jacobian_time_dependent_t<Map, T>::value;
+
+// @{
+/// Check if the Jacobian of the coordinate map is known at compile time to be
+/// the identity, even though the map itself need not be the identity (e.g. a
+/// time-dependent translation).
+///
+/// A map signals this by declaring `static constexpr bool jacobian_is_identity
+/// = true;`. `CoordinateMap` uses this to skip computing and multiplying the
+/// Jacobian and inverse Jacobian of such maps.
+template <typename Map,
+          bool = detail::has_jacobian_is_identity_v<std::decay_t<Map>, bool>>
+struct is_jacobian_identity : std::false_type {};
+
+/// \cond
+template <typename Map>
+struct is_jacobian_identity<Map, true>
+    : std::bool_constant<std::decay_t<Map>::jacobian_is_identity> {};
+/// \endcond
+
+template <typename Map>
+constexpr bool is_jacobian_identity_v = is_jacobian_identity<Map>::value;
+// @}
 }  // namespace domain
@@ -0,0 +1,262 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/ElementDistribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Domain/Block.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+namespace {
+// Position of the element along a Morton curve through its block. Dimensions
+// with a lower refinement level are treated as if refined to the maximum
+// level, so that the curve is well defined for anisotropic refinement.
+template <size_t Dim>
+size_t z_curve_index(const ElementId<Dim>& element_id) noexcept {
+  size_t max_refinement_level = 0;
+  for (const auto& segment_id : element_id.segment_ids()) {
+    max_refinement_level =
+        std::max(max_refinement_level, segment_id.refinement_level());
+  }
+  ASSERT(Dim * max_refinement_level <= std::numeric_limits<size_t>::digits,
+         "Refinement level " << max_refinement_level
+                             << " is too high to compute a Z-curve index.");
+  std::array<size_t, Dim> scaled_indices{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& segment_id = gsl::at(element_id.segment_ids(), d);
+    gsl::at(scaled_indices, d) =
+        segment_id.index()
+        << (max_refinement_level - segment_id.refinement_level());
+  }
+  size_t result = 0;
+  for (size_t bit = max_refinement_level; bit-- > 0;) {
+    for (size_t d = 0; d < Dim; ++d) {
+      result = (result << 1) | ((gsl::at(scaled_indices, d) >> bit) & 1);
+    }
+  }
+  return result;
+}
+
+// Breadth-first ordering of the blocks over their face neighbors. Each block
+// that has not been reached from an earlier block starts a new search, so
+// domains with disconnected blocks are handled.
+template <size_t Dim>
+std::vector<size_t> block_ordering(
+    const std::vector<Block<Dim>>& blocks) noexcept {
+  std::vector<size_t> ordering{};
+  ordering.reserve(blocks.size());
+  std::vector<bool> visited(blocks.size(), false);
+  std::deque<size_t> to_visit{};
+  std::vector<size_t> neighbor_ids{};
+  for (size_t first_block = 0; first_block < blocks.size(); ++first_block) {
+    if (visited[first_block]) {
+      continue;
+    }
+    visited[first_block] = true;
+    to_visit.push_back(first_block);
+    while (not to_visit.empty()) {
+      const size_t block_id = to_visit.front();
+      to_visit.pop_front();
+      ordering.push_back(block_id);
+      // sort the neighbors so the ordering doesn't depend on the iteration
+      // order of the neighbors map
+      neighbor_ids.clear();
+      for (const auto& direction_and_neighbor : blocks[block_id].neighbors()) {
+        neighbor_ids.push_back(direction_and_neighbor.second.id());
+      }
+      alg::sort(neighbor_ids);
+      for (const size_t neighbor_id : neighbor_ids) {
+        if (not visited[neighbor_id]) {
+          visited[neighbor_id] = true;
+          to_visit.push_back(neighbor_id);
+        }
+      }
+    }
+  }
+  return ordering;
+}
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os,
+                         const ElementPlacement& element_placement) noexcept {
+  switch (element_placement) {
+    case ElementPlacement::RoundRobin:
+      return os << "RoundRobin";
+    case ElementPlacement::ZCurve:
+      return os << "ZCurve";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR(
+          "Need to add another case, don't understand value of "
+          "'element_placement'");
+      // LCOV_EXCL_STOP
+  }
+}
+
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>>
+round_robin_element_distribution(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const size_t number_of_procs) noexcept {
+  ASSERT(blocks.size() == initial_refinement_levels.size(),
+         "Expected refinement levels for each of the "
+             << blocks.size() << " blocks, but got "
+             << initial_refinement_levels.size());
+  ASSERT(number_of_procs > 0, "The number of processors must be positive.");
+
+  std::vector<std::pair<ElementId<Dim>, size_t>> result{};
+  size_t which_proc = 0;
+  for (const auto& block : blocks) {
+    for (auto& element_id : initial_element_ids(
+             block.id(), initial_refinement_levels[block.id()])) {
+      result.emplace_back(std::move(element_id), which_proc);
+      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+    }
+  }
+  return result;
+}
+
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>> z_curve_element_distribution(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const size_t number_of_procs) noexcept {
+  ASSERT(blocks.size() == initial_refinement_levels.size() and
+             blocks.size() == initial_extents.size(),
+         "Expected refinement levels and extents for each of the "
+             << blocks.size() << " blocks, but got "
+             << initial_refinement_levels.size() << " and "
+             << initial_extents.size());
+  ASSERT(number_of_procs > 0, "The number of processors must be positive.");
+
+  std::vector<std::pair<ElementId<Dim>, size_t>> result{};
+  std::vector<double> costs{};
+  double total_cost = 0.0;
+  for (const size_t block_id : block_ordering(blocks)) {
+    std::vector<ElementId<Dim>> element_ids =
+        initial_element_ids(block_id, initial_refinement_levels[block_id]);
+    std::vector<std::pair<size_t, ElementId<Dim>>> indexed_element_ids{};
+    indexed_element_ids.reserve(element_ids.size());
+    for (auto& element_id : element_ids) {
+      indexed_element_ids.emplace_back(z_curve_index(element_id),
+                                       std::move(element_id));
+    }
+    alg::sort(indexed_element_ids,
+              [](const auto& lhs, const auto& rhs) noexcept {
+                return lhs.first < rhs.first;
+              });
+
+    double cost = 1.0;
+    for (const size_t extent : initial_extents[block_id]) {
+      cost *= static_cast<double>(extent);
+    }
+    for (auto& indexed_element_id : indexed_element_ids) {
+      result.emplace_back(std::move(indexed_element_id.second), 0);
+      costs.push_back(cost);
+      total_cost += cost;
+    }
+  }
+
+  // each element goes to the processor whose equal share of the total cost
+  // contains the midpoint of the element's cost
+  double cost_before = 0.0;
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i].second = std::min(
+        number_of_procs - 1,
+        static_cast<size_t>((cost_before + 0.5 * costs[i]) *
+                            static_cast<double>(number_of_procs) / total_cost));
+    cost_before += costs[i];
+  }
+  return result;
+}
+
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>> element_distribution(
+    const ElementPlacement element_placement,
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const size_t number_of_procs) noexcept {
+  switch (element_placement) {
+    case ElementPlacement::RoundRobin:
+      return round_robin_element_distribution(
+          blocks, initial_refinement_levels, number_of_procs);
+    case ElementPlacement::ZCurve:
+      return z_curve_element_distribution(blocks, initial_refinement_levels,
+                                          initial_extents, number_of_procs);
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR(
+          "Need to add another case, don't understand value of "
+          "'element_placement'");
+      // LCOV_EXCL_STOP
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                             \
+  template std::vector<std::pair<ElementId<DIM(data)>, size_t>>          \
+  round_robin_element_distribution(                                      \
+      const std::vector<Block<DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, DIM(data)>>&                  \
+          initial_refinement_levels,                                     \
+      size_t number_of_procs) noexcept;                                  \
+  template std::vector<std::pair<ElementId<DIM(data)>, size_t>>          \
+  z_curve_element_distribution(                                          \
+      const std::vector<Block<DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, DIM(data)>>&                  \
+          initial_refinement_levels,                                     \
+      const std::vector<std::array<size_t, DIM(data)>>& initial_extents, \
+      size_t number_of_procs) noexcept;                                  \
+  template std::vector<std::pair<ElementId<DIM(data)>, size_t>>          \
+  element_distribution(                                                  \
+      ElementPlacement element_placement,                                \
+      const std::vector<Block<DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, DIM(data)>>&                  \
+          initial_refinement_levels,                                     \
+      const std::vector<std::array<size_t, DIM(data)>>& initial_extents, \
+      size_t number_of_procs) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
+
+template <>
+domain::ElementPlacement
+create_from_yaml<domain::ElementPlacement>::create<void>(
+    const Option& options) {
+  const auto type_read = options.parse_as<std::string>();
+  if ("RoundRobin" == type_read) {
+    return domain::ElementPlacement::RoundRobin;
+  } else if ("ZCurve" == type_read) {
+    return domain::ElementPlacement::ZCurve;
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \"" << type_read
+                                     << "\" to ElementPlacement. Must be one "
+                                        "of RoundRobin or ZCurve.");
+}
@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+
+/// \cond
+template <size_t VolumeDim>
+class Block;
+template <size_t VolumeDim>
+class ElementId;
+template <typename T>
+struct create_from_yaml;
+class Option;
+/// \endcond
+
+namespace domain {
+/// \ingroup ComputationalDomainGroup
+/// \brief How the elements of the initial domain are assigned to processors
+///
+/// - `RoundRobin`: see `domain::round_robin_element_distribution`
+/// - `ZCurve`: see `domain::z_curve_element_distribution`
+enum class ElementPlacement { RoundRobin, ZCurve };
+
+std::ostream& operator<<(std::ostream& os,
+                         const ElementPlacement& element_placement) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Assigns the elements of the initial domain to the processors in turn,
+ * visiting the blocks in order of their id.
+ *
+ * \details This ignores the connectivity and the cost of the elements, so face
+ * neighbors are generally placed on different processors.
+ *
+ * Returns every initial element id in the order described above, paired with
+ * the processor it is assigned to.
+ */
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>>
+round_robin_element_distribution(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    size_t number_of_procs) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Assigns each element of the initial domain to a processor, keeping
+ * elements that share a face on the same processor where possible.
+ *
+ * \details The blocks are visited in breadth-first order over their face
+ * neighbors, starting from block 0, so that consecutive blocks share a face
+ * wherever the domain permits. Within each block the elements are ordered along
+ * a Morton (Z-order) curve of their segment indices. This sequence of elements
+ * is then divided into `number_of_procs` contiguous chunks of approximately
+ * equal cost, where the cost of an element is its number of grid points.
+ * Charm++ numbers the processors on a node consecutively, so the contiguous
+ * chunks also keep neighboring elements on the same node where possible.
+ *
+ * Returns every initial element id in the order described above, paired with
+ * the processor it is assigned to.
+ */
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>> z_curve_element_distribution(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    size_t number_of_procs) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief Assigns each element of the initial domain to a processor with the
+/// distribution selected by `element_placement`
+template <size_t Dim>
+std::vector<std::pair<ElementId<Dim>, size_t>> element_distribution(
+    ElementPlacement element_placement, const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    size_t number_of_procs) noexcept;
+}  // namespace domain
+
+template <>
+struct create_from_yaml<domain::ElementPlacement> {
+  template <typename Metavariables>
+  static domain::ElementPlacement create(const Option& options) {
+    return create<void>(options);
+  }
+};
+template <>
+domain::ElementPlacement
+create_from_yaml<domain::ElementPlacement>::create<void>(
+    const Option& options);
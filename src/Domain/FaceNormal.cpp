@@ -160,6 +160,39 @@ tnsr::i<DataVector, VolumeDim, Frame::Inertial> unnormalized_face_normal(
   return result;
 }
 
+template <size_t VolumeDim>
+void unnormalized_face_normal(
+    const gsl::not_null<tnsr::i<DataVector, VolumeDim, Frame::Inertial>*>
+        result,
+    const tnsr::i<DataVector, VolumeDim, Frame::Grid>& grid_face_normal,
+    const tnsr::I<DataVector, VolumeDim, Frame::Grid>& grid_face_coordinates,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>&
+        grid_to_inertial_map,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) noexcept {
+  destructive_resize_components(result, get<0>(grid_face_normal).size());
+  if (grid_to_inertial_map.is_identity()) {
+    for (size_t i = 0; i < VolumeDim; ++i) {
+      result->get(i) = grid_face_normal.get(i);
+    }
+    return;
+  }
+
+  const auto grid_to_inertial_inv_jac = grid_to_inertial_map.inv_jacobian(
+      grid_face_coordinates, time, functions_of_time);
+  for (size_t inertial_i = 0; inertial_i < VolumeDim; ++inertial_i) {
+    result->get(inertial_i) =
+        grid_face_normal.get(0) * grid_to_inertial_inv_jac.get(0, inertial_i);
+    for (size_t grid_i = 1; grid_i < VolumeDim; ++grid_i) {
+      result->get(inertial_i) +=
+          grid_face_normal.get(grid_i) *
+          grid_to_inertial_inv_jac.get(grid_i, inertial_i);
+    }
+  }
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define GET_FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
@@ -221,7 +254,22 @@ GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3),
           std::string,                                                      \
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&        \
           functions_of_time,                                                \
-      const Direction<GET_DIM(data)>& direction) noexcept;
+      const Direction<GET_DIM(data)>& direction) noexcept;                  \
+  template void unnormalized_face_normal(                                   \
+      const gsl::not_null<                                                  \
+          tnsr::i<DataVector, GET_DIM(data), Frame::Inertial>*>             \
+          result,                                                           \
+      const tnsr::i<DataVector, GET_DIM(data), Frame::Grid>&                \
+          grid_face_normal,                                                 \
+      const tnsr::I<DataVector, GET_DIM(data), Frame::Grid>&                \
+          grid_face_coordinates,                                            \
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial,         \
+                                      GET_DIM(data)>& grid_to_inertial_map, \
+      const double time,                                                    \
+      const std::unordered_map<                                             \
+          std::string,                                                      \
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&        \
+          functions_of_time) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
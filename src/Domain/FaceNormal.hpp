@@ -104,6 +104,30 @@ tnsr::i<DataVector, VolumeDim, Frame::Inertial> unnormalized_face_normal(
     const Direction<VolumeDim>& direction) noexcept;
 // @}
 
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Compute the outward inertial normal on a face of an Element from the
+ * grid normal on the face
+ *
+ * \details
+ * The logical to grid map doesn't depend on time, so on a moving mesh the grid
+ * normal and grid coordinates on a face need only be computed once. The
+ * inertial normal is then updated by mapping the grid normal with the inverse
+ * Jacobian of the time-dependent grid to inertial map at the grid
+ * coordinates of the face.
+ */
+template <size_t VolumeDim>
+void unnormalized_face_normal(
+    gsl::not_null<tnsr::i<DataVector, VolumeDim, Frame::Inertial>*> result,
+    const tnsr::i<DataVector, VolumeDim, Frame::Grid>& grid_face_normal,
+    const tnsr::I<DataVector, VolumeDim, Frame::Grid>& grid_face_coordinates,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>&
+        grid_to_inertial_map,
+    double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) noexcept;
+
 namespace domain {
 namespace Tags {
 /// \ingroup DataBoxTagsGroup
@@ -130,6 +154,17 @@ struct UnnormalizedFaceNormalCompute
   using volume_tags = tmpl::list<ElementMap<VolumeDim, Frame>>;
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The unnormalized face normal one form on a moving mesh. Computed from the
+/// time-independent grid normal and grid coordinates on the face, which must
+/// also be in the DataBox (see `UnnormalizedFaceNormalCompute` and
+/// `BoundaryGridCoordinates`), so only the grid to inertial map is evaluated
+/// when the mesh moves.
+///
+/// On the exterior side of external boundaries the grid normal is inverted
+/// (see the specialization of `InterfaceCompute` for
+/// `UnnormalizedFaceNormalCompute`), and so is the normal computed from it.
 template <size_t VolumeDim>
 struct UnnormalizedFaceNormalMovingMeshCompute
     : db::ComputeTag,
@@ -137,22 +172,23 @@ struct UnnormalizedFaceNormalMovingMeshCompute
   using base = UnnormalizedFaceNormal<VolumeDim, Frame::Inertial>;
   using return_type = typename base::type;
   static constexpr auto function = static_cast<void (*)(
-      gsl::not_null<return_type*>, const ::Mesh<VolumeDim - 1>&,
-      const ::ElementMap<VolumeDim, Frame::Grid>&,
+      gsl::not_null<return_type*>,
+      const tnsr::i<DataVector, VolumeDim, Frame::Grid>&,
+      const tnsr::I<DataVector, VolumeDim, Frame::Grid>&,
       const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>&,
       double,
       const std::unordered_map<
           std::string,
-          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&,
-      const ::Direction<VolumeDim>&) noexcept>(&unnormalized_face_normal);
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&) noexcept>(
+      &unnormalized_face_normal);
   using argument_tags =
-      tmpl::list<Mesh<VolumeDim - 1>, ElementMap<VolumeDim, Frame::Grid>,
+      tmpl::list<UnnormalizedFaceNormal<VolumeDim, Frame::Grid>,
+                 Coordinates<VolumeDim, Frame::Grid>,
                  CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
                                                      Frame::Inertial>,
-                 ::Tags::Time, Tags::FunctionsOfTime, Direction<VolumeDim>>;
+                 ::Tags::Time, Tags::FunctionsOfTime>;
   using volume_tags =
-      tmpl::list<ElementMap<VolumeDim, Frame::Grid>,
-                 CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
+      tmpl::list<CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
                                                      Frame::Inertial>,
                  ::Tags::Time, Tags::FunctionsOfTime>;
 };
@@ -196,53 +232,5 @@ struct InterfaceCompute<Tags::BoundaryDirectionsExterior<VolumeDim>,
                                    Tags::ElementMap<VolumeDim, Frame>>;
 };
 
-template <size_t VolumeDim>
-struct InterfaceCompute<Tags::BoundaryDirectionsExterior<VolumeDim>,
-                        UnnormalizedFaceNormalMovingMeshCompute<VolumeDim>>
-    : db::PrefixTag,
-      db::ComputeTag,
-      Tags::Interface<
-          Tags::BoundaryDirectionsExterior<VolumeDim>,
-          Tags::UnnormalizedFaceNormal<VolumeDim, Frame::Inertial>> {
-  using dirs = BoundaryDirectionsExterior<VolumeDim>;
-
-  static std::string name() noexcept {
-    return "BoundaryDirectionsExterior<UnnormalizedFaceNormal>";
-  }
-  using return_type =
-      std::unordered_map<::Direction<VolumeDim>,
-                         tnsr::i<DataVector, VolumeDim, Frame::Inertial>>;
-  static void function(
-      const gsl::not_null<return_type*> normals,
-      const std::unordered_map<::Direction<VolumeDim>, ::Mesh<VolumeDim - 1>>&
-          meshes,
-      const ::ElementMap<VolumeDim, Frame::Grid>& logical_to_grid_map,
-      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>&
-          grid_to_inertial_map,
-      const double time,
-      const std::unordered_map<
-          std::string,
-          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
-          functions_of_time) noexcept {
-    for (const auto& direction_and_mesh : meshes) {
-      const auto& direction = direction_and_mesh.first;
-      const auto& mesh = direction_and_mesh.second;
-      auto internal_face_normal = unnormalized_face_normal(
-          mesh, logical_to_grid_map, grid_to_inertial_map, time,
-          functions_of_time, direction);
-      std::transform(internal_face_normal.begin(), internal_face_normal.end(),
-                     internal_face_normal.begin(), std::negate<>());
-      (*normals)[direction] = std::move(internal_face_normal);
-    }
-  }
-
-  using argument_tags =
-      tmpl::list<Tags::Interface<dirs, Mesh<VolumeDim - 1>>,
-                 Tags::ElementMap<VolumeDim, Frame::Grid>,
-                 CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
-                                                     Frame::Inertial>,
-                 ::Tags::Time, Tags::FunctionsOfTime>;
-};
-
 }  // namespace Tags
 }  // namespace domain
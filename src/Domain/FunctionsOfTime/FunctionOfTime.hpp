@@ -4,11 +4,13 @@
 #pragma once
 
 #include <array>
+#include <limits>
 #include <memory>
 #include <pup.h>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "Parallel/CharmPupable.hpp"
 
 namespace domain {
@@ -31,11 +33,33 @@ class FunctionOfTime : public PUP::able {
 
   virtual std::array<double, 2> time_bounds() const noexcept = 0;
 
+  /// The latest time at which the function may be evaluated. Functions that
+  /// are updated during the evolution (see `update`) are only known up to this
+  /// time, so anything that evaluates them must wait for an update before
+  /// going past it.
+  virtual double expiration_time() const noexcept {
+    return std::numeric_limits<double>::max();
+  }
+
+  /// Replaces the function after `time_of_update` and extends its validity to
+  /// `next_expiration_time`. Only functions that can be updated during the
+  /// evolution implement this.
+  virtual void update(double time_of_update, DataVector /*updated_max_deriv*/,
+                      double next_expiration_time) noexcept {
+    ERROR("This FunctionOfTime cannot be updated. Attempted an update at time "
+          << time_of_update << " expiring at " << next_expiration_time);
+  }
+
   virtual std::array<DataVector, 1> func(double t) const noexcept = 0;
   virtual std::array<DataVector, 2> func_and_deriv(double t) const noexcept = 0;
   virtual std::array<DataVector, 3> func_and_2_derivs(double t) const
       noexcept = 0;
 
+  /// Discard the data needed only to evaluate the function before `time`.
+  /// Functions that accumulate data as they are updated override this so
+  /// their memory does not grow without bound over a long evolution.
+  virtual void truncate_before(const double time) noexcept { (void)time; }
+
   WRAPPED_PUPable_abstract(FunctionOfTime);  // NOLINT
 };
 }  // namespace FunctionsOfTime
@@ -21,8 +21,15 @@ namespace domain {
 namespace FunctionsOfTime {
 template <size_t MaxDeriv>
 PiecewisePolynomial<MaxDeriv>::PiecewisePolynomial(
-    const double t, value_type initial_func_and_derivs) noexcept
-    : deriv_info_at_update_times_{{t, std::move(initial_func_and_derivs)}} {}
+    const double t, value_type initial_func_and_derivs,
+    const double expiration_time) noexcept
+    : deriv_info_at_update_times_{{t, std::move(initial_func_and_derivs)}},
+      expiration_time_(expiration_time) {
+  if (expiration_time_ < t) {
+    ERROR("The expiration time " << expiration_time_
+                                 << " precedes the initial time " << t << ".");
+  }
+}
 
 template <size_t MaxDeriv>
 std::unique_ptr<FunctionOfTime> PiecewisePolynomial<MaxDeriv>::get_clone() const
@@ -34,6 +41,12 @@ template <size_t MaxDeriv>
 template <size_t MaxDerivReturned>
 std::array<DataVector, MaxDerivReturned + 1>
 PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
+  if (t > expiration_time_ and
+      not equal_within_roundoff(t, expiration_time_)) {
+    ERROR("requested time " << t << " is past the expiration time "
+                            << expiration_time_
+                            << ". Wait for an update before evaluating.");
+  }
   const auto& deriv_info_at_t = deriv_info_from_upper_bound(t);
   const double dt = t - deriv_info_at_t.time;
   const value_type& coefs = deriv_info_at_t.derivs_coefs;
@@ -64,6 +77,35 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
 template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::update(
     const double time_of_update, DataVector updated_max_deriv) noexcept {
+  add_update(time_of_update, std::move(updated_max_deriv));
+}
+
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::update(
+    const double time_of_update, DataVector updated_max_deriv,
+    const double next_expiration_time) noexcept {
+  // The function may already have been evaluated anywhere up to the current
+  // expiration time, so it can't be changed before that.
+  if (time_of_update < expiration_time_) {
+    ERROR("Attempted to update at time "
+          << time_of_update << ", which precedes the expiration time "
+          << expiration_time_ << ".");
+  }
+  if (next_expiration_time < time_of_update) {
+    ERROR("The next expiration time " << next_expiration_time
+                                      << " precedes the update time "
+                                      << time_of_update << ".");
+  }
+  // Extend the validity first so the current values at the update time can
+  // be evaluated.
+  expiration_time_ = time_of_update;
+  add_update(time_of_update, std::move(updated_max_deriv));
+  expiration_time_ = next_expiration_time;
+}
+
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::add_update(
+    const double time_of_update, DataVector updated_max_deriv) noexcept {
   if (time_of_update <= deriv_info_at_update_times_.back().time) {
     ERROR("t must be increasing from call to call. "
           << "Attempted to update at time " << time_of_update
@@ -86,6 +128,20 @@ void PiecewisePolynomial<MaxDeriv>::update(
   deriv_info_at_update_times_.emplace_back(time_of_update, std::move(func));
 }
 
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::truncate_before(
+    const double time) noexcept {
+  // the first segment starting after `time`
+  const auto later_segment = std::upper_bound(
+      deriv_info_at_update_times_.begin(), deriv_info_at_update_times_.end(),
+      time, [](double t0, const DerivInfo& d) { return d.time > t0; });
+  if (later_segment - deriv_info_at_update_times_.begin() > 1) {
+    deriv_info_at_update_times_.erase(deriv_info_at_update_times_.begin(),
+                                      std::prev(later_segment));
+    segment_hint_ = 0;
+  }
+}
+
 template <size_t MaxDeriv>
 PiecewisePolynomial<MaxDeriv>::DerivInfo::DerivInfo(const double t,
                                                     value_type deriv) noexcept
@@ -118,6 +174,19 @@ PiecewisePolynomial<MaxDeriv>::deriv_info_from_upper_bound(const double t) const
   // this function assumes that the times in deriv_info_at_update_times is
   // sorted, which is enforced by the update function.
 
+  // Evaluations are usually at the same or increasing times, so first check
+  // the segment used last and the one after it.
+  const size_t number_of_segments = deriv_info_at_update_times_.size();
+  for (size_t segment = segment_hint_;
+       segment < std::min(segment_hint_ + 2, number_of_segments); ++segment) {
+    if (deriv_info_at_update_times_[segment].time <= t and
+        (segment + 1 == number_of_segments or
+         t < deriv_info_at_update_times_[segment + 1].time)) {
+      segment_hint_ = segment;
+      return deriv_info_at_update_times_[segment];
+    }
+  }
+
   const auto upper_bound_deriv_info = std::upper_bound(
       deriv_info_at_update_times_.begin(), deriv_info_at_update_times_.end(), t,
       [](double t0, const DerivInfo& d) { return d.time > t0; });
@@ -137,6 +206,9 @@ PiecewisePolynomial<MaxDeriv>::deriv_info_from_upper_bound(const double t) const
   // or t is within the range of times.
   // In both cases, 'upper_bound_deriv_info' currently points to one index past
   // the desired index.
+  segment_hint_ = static_cast<size_t>(
+      std::distance(deriv_info_at_update_times_.begin(),
+                    std::prev(upper_bound_deriv_info, 1)));
   return *std::prev(upper_bound_deriv_info, 1);
 }
 
@@ -144,12 +216,14 @@ template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
   p | deriv_info_at_update_times_;
+  p | expiration_time_;
 }
 
 template <size_t MaxDeriv>
 bool operator==(const PiecewisePolynomial<MaxDeriv>& lhs,
                 const PiecewisePolynomial<MaxDeriv>& rhs) noexcept {
-  return lhs.deriv_info_at_update_times_ == rhs.deriv_info_at_update_times_;
+  return lhs.deriv_info_at_update_times_ == rhs.deriv_info_at_update_times_ and
+         lhs.expiration_time_ == rhs.expiration_time_;
 }
 
 template <size_t MaxDeriv>
@@ -177,9 +251,9 @@ GENERATE_INSTANTIATIONS(INSTANTIATE, (2, 3, 4))
 
 #undef INSTANTIATE
 
-#define INSTANTIATE(_, data)                                          \
-  template std::array<DataVector, DIMRETURNED(data) + 1>              \
-  PiecewisePolynomial<DIM(data)>::func_and_derivs<DIMRETURNED(data)>( \
+#define INSTANTIATE(_, data)                                               \
+  template std::array<DataVector, DIMRETURNED(data) + 1>                   \
+  PiecewisePolynomial<DIM(data)>::func_and_derivs<DIMRETURNED(data)>(      \
       const double) const noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (2), (0, 1, 2))
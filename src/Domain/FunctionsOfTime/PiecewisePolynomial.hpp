@@ -18,13 +18,28 @@ namespace domain {
 namespace FunctionsOfTime {
 /// \ingroup ComputationalDomainGroup
 /// \brief A function that has a piecewise-constant `MaxDeriv`th derivative.
+///
+/// \details A function that is updated during the evolution (e.g. by a
+/// control system) is only known up to its `expiration_time()`. Each update
+/// made with `update(double, DataVector, double)` starts at the previous
+/// expiration time and extends the function to the next one, so the segments
+/// can be sent to the elements asynchronously and each element only has to
+/// wait for an update when it needs the function past the expiration time.
+/// Functions that are never updated, or that are updated synchronously with
+/// `update(double, DataVector)`, never expire.
+///
+/// The function is usually evaluated at the same or increasing times, so the
+/// segment used by the last evaluation is checked before searching all the
+/// segments, making the lookup constant time. The segments that are no longer
+/// needed can be discarded with `truncate_before`.
 template <size_t MaxDeriv>
 class PiecewisePolynomial : public FunctionOfTime {
  public:
   PiecewisePolynomial() = default;
   PiecewisePolynomial(
       double t,
-      std::array<DataVector, MaxDeriv + 1> initial_func_and_derivs) noexcept;
+      std::array<DataVector, MaxDeriv + 1> initial_func_and_derivs,
+      double expiration_time = std::numeric_limits<double>::max()) noexcept;
 
   ~PiecewisePolynomial() override = default;
   PiecewisePolynomial(PiecewisePolynomial&&) noexcept = default;
@@ -58,12 +73,23 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// Updates the `MaxDeriv`th derivative of the function at the given time.
   /// `updated_max_deriv` is a vector of the `MaxDeriv`ths for each component
   void update(double time_of_update, DataVector updated_max_deriv) noexcept;
+  /// Updates the `MaxDeriv`th derivative of the function at the given time,
+  /// which must not precede the current expiration time, and makes the
+  /// function valid up to `next_expiration_time`.
+  void update(double time_of_update, DataVector updated_max_deriv,
+              double next_expiration_time) noexcept override;
   /// Returns the domain of validity of the function.
   std::array<double, 2> time_bounds() const noexcept override {
     return {{deriv_info_at_update_times_.front().time,
              deriv_info_at_update_times_.back().time}};
   }
 
+  double expiration_time() const noexcept override { return expiration_time_; }
+
+  /// Discards the segments that end before `time`. The function can no longer
+  /// be evaluated before the start of the segment containing `time`.
+  void truncate_before(double time) noexcept override;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override;
 
@@ -110,7 +136,17 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// in which case it returns the DerivInfo at the earliest update time.)
   const DerivInfo& deriv_info_from_upper_bound(double t) const noexcept;
 
+  // Appends a segment starting at `time_of_update`, which must be inside the
+  // domain of validity.
+  void add_update(double time_of_update,
+                  DataVector updated_max_deriv) noexcept;
+
   std::vector<DerivInfo> deriv_info_at_update_times_;
+  double expiration_time_{std::numeric_limits<double>::max()};
+  // The index of the segment used by the last evaluation. Each element holds
+  // its own copy of the functions of time, so this is not shared between
+  // threads.
+  mutable size_t segment_hint_{0};
 };
 
 template <size_t MaxDeriv>
@@ -245,7 +245,9 @@ struct InterfaceMesh : db::ComputeTag, Tags::Mesh<VolumeDim - 1> {
 /// \ingroup ComputationalDomainGroup
 /// Computes the coordinates in the frame `Frame` on the faces defined by
 /// `Direction`. Intended to be prefixed by a `Tags::InterfaceCompute` to
-/// define the directions on which to compute the coordinates.
+/// define the directions on which to compute the coordinates. On a moving mesh
+/// the grid coordinates on the faces must also be available (see
+/// `Tags::BoundaryGridCoordinates`).
 template <size_t VolumeDim, bool MovingMesh = false>
 struct BoundaryCoordinates : db::ComputeTag,
                              Tags::Coordinates<VolumeDim, Frame::Inertial> {
@@ -262,9 +264,7 @@ struct BoundaryCoordinates : db::ComputeTag,
 
   static void function(
       const gsl::not_null<return_type*> boundary_coords,
-      const ::Direction<VolumeDim>& direction,
-      const ::Mesh<VolumeDim - 1>& interface_mesh,
-      const ::ElementMap<VolumeDim, ::Frame::Grid>& logical_to_grid_map,
+      const tnsr::I<DataVector, VolumeDim, Frame::Grid>& grid_boundary_coords,
       const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>&
           grid_to_inertial_map,
       const double time,
@@ -273,16 +273,13 @@ struct BoundaryCoordinates : db::ComputeTag,
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) noexcept {
     *boundary_coords =
-        grid_to_inertial_map(logical_to_grid_map(interface_logical_coordinates(
-                                 interface_mesh, direction)),
-                             time, functions_of_time);
+        grid_to_inertial_map(grid_boundary_coords, time, functions_of_time);
   }
 
   static std::string name() noexcept { return "BoundaryCoordinates"; }
   using argument_tags = tmpl::conditional_t<
       MovingMesh,
-      tmpl::list<Direction<VolumeDim>, Mesh<VolumeDim - 1>,
-                 Tags::ElementMap<VolumeDim, Frame::Grid>,
+      tmpl::list<Coordinates<VolumeDim, Frame::Grid>,
                  CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
                                                      Frame::Inertial>,
                  ::Tags::Time, domain::Tags::FunctionsOfTime>,
@@ -290,13 +287,41 @@ struct BoundaryCoordinates : db::ComputeTag,
                  ElementMap<VolumeDim, Frame::Inertial>>>;
   using volume_tags = tmpl::conditional_t<
       MovingMesh,
-      tmpl::list<Tags::ElementMap<VolumeDim, Frame::Grid>,
-                 CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
+      tmpl::list<CoordinateMaps::Tags::CoordinateMap<VolumeDim, Frame::Grid,
                                                      Frame::Inertial>,
                  ::Tags::Time, domain::Tags::FunctionsOfTime>,
       tmpl::list<ElementMap<VolumeDim, Frame::Inertial>>>;
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// Computes the grid coordinates on the faces defined by `Direction`. The
+/// logical to grid map doesn't depend on time, so on a moving mesh these are
+/// computed once and reused by `Tags::BoundaryCoordinates` and
+/// `Tags::UnnormalizedFaceNormalMovingMeshCompute`. Intended to be prefixed by
+/// a `Tags::InterfaceCompute` to define the directions on which to compute the
+/// coordinates.
+template <size_t VolumeDim>
+struct BoundaryGridCoordinates : db::ComputeTag,
+                                 Tags::Coordinates<VolumeDim, Frame::Grid> {
+  using base = Tags::Coordinates<VolumeDim, Frame::Grid>;
+  using return_type = typename base::type;
+  static void function(
+      const gsl::not_null<return_type*> boundary_coords,
+      const ::Direction<VolumeDim>& direction,
+      const ::Mesh<VolumeDim - 1>& interface_mesh,
+      const ::ElementMap<VolumeDim, Frame::Grid>&
+          logical_to_grid_map) noexcept {
+    *boundary_coords = logical_to_grid_map(
+        interface_logical_coordinates(interface_mesh, direction));
+  }
+
+  static std::string name() noexcept { return "BoundaryGridCoordinates"; }
+  using argument_tags = tmpl::list<Direction<VolumeDim>, Mesh<VolumeDim - 1>,
+                                   ElementMap<VolumeDim, Frame::Grid>>;
+  using volume_tags = tmpl::list<ElementMap<VolumeDim, Frame::Grid>>;
+};
+
 }  // namespace Tags
 }  // namespace domain
 
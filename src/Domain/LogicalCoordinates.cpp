@@ -6,7 +6,9 @@
 
 #include "Domain/LogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/IndexIterator.hpp"
@@ -23,14 +25,26 @@ void logical_coordinates(
     const gsl::not_null<tnsr::I<DataVector, VolumeDim, Frame::Logical>*>
         logical_coords,
     const Mesh<VolumeDim>& mesh) noexcept {
-  destructive_resize_components(logical_coords, mesh.number_of_grid_points());
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  destructive_resize_components(logical_coords, number_of_grid_points);
+  // The points vary fastest in the first dimension, so in dimension `d` each
+  // collocation point fills a contiguous run of `stride` grid points
+  size_t stride = 1;
   for (size_t d = 0; d < VolumeDim; ++d) {
     const auto& collocation_points_in_this_dim =
         Spectral::collocation_points(mesh.slice_through(d));
-    for (IndexIterator<VolumeDim> index(mesh.extents()); index; ++index) {
-      logical_coords->get(d)[index.collapsed_index()] =
-          collocation_points_in_this_dim[index()[d]];
+    const size_t extent = mesh.extents(d);
+    auto& logical_coords_in_this_dim = logical_coords->get(d);
+    for (size_t offset = 0; offset < number_of_grid_points;
+         offset += stride * extent) {
+      for (size_t i = 0; i < extent; ++i) {
+        const auto run_begin = logical_coords_in_this_dim.begin() +
+                               static_cast<std::ptrdiff_t>(offset + i * stride);
+        std::fill(run_begin, run_begin + static_cast<std::ptrdiff_t>(stride),
+                  collocation_points_in_this_dim[i]);
+      }
     }
+    stride *= extent;
   }
 }
 
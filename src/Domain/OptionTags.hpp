@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <memory>
 
+#include "Domain/ElementDistribution.hpp"
 #include "Options/Options.hpp"
 
 /// \cond
@@ -23,5 +24,19 @@ struct DomainCreator {
   using type = std::unique_ptr<::DomainCreator<Dim>>;
   static constexpr OptionString help = {"The domain to create initially"};
 };
+
+/// \ingroup OptionTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The input file tag for how the elements of the initial domain are assigned
+/// to processors
+struct ElementPlacement {
+  using type = ::domain::ElementPlacement;
+  static constexpr OptionString help = {
+      "How to assign the initial elements to processors: RoundRobin or "
+      "ZCurve"};
+  static type default_value() noexcept {
+    return ::domain::ElementPlacement::ZCurve;
+  }
+};
 }  // namespace OptionTags
 }  // namespace domain
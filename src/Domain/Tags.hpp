@@ -89,6 +89,20 @@ struct InitialRefinementLevels : db::SimpleTag {
       const std::unique_ptr<::DomainCreator<Dim>>& domain_creator) noexcept;
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// How the elements of the initial domain are assigned to processors
+struct ElementPlacement : db::SimpleTag {
+  using type = ::domain::ElementPlacement;
+  using option_tags = tmpl::list<domain::OptionTags::ElementPlacement>;
+
+  static constexpr bool pass_metavariables = false;
+  static ::domain::ElementPlacement create_from_options(
+      const ::domain::ElementPlacement& element_placement) noexcept {
+    return element_placement;
+  }
+};
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup ComputationalDomainGroup
 /// The ::Element associated with the DataBox
@@ -9,6 +9,7 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Parallel/PerformanceCounters.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
@@ -50,6 +51,7 @@ namespace Actions {
  * DataBox changes:
  * - Modifies:
  *   - `TimeDerivativeComputer::return_tags<step_prefix>`
+ *   - `Parallel::Tags::PerformanceCounters` (if present)
  */
 template <typename TimeDerivativeComputer>
 struct ComputeTimeDerivative {
@@ -73,6 +75,8 @@ struct ComputeTimeDerivative {
                          Metavariables::temporal_id::template step_prefix>,
                      typename TimeDerivativeComputer::argument_tags>(
         TimeDerivativeComputer{}, make_not_null(&box));
+    Parallel::increment_performance_counter(
+        make_not_null(&box), Parallel::PerformanceCounter::RhsEvaluations);
     return std::forward_as_tuple(std::move(box));
   }
 };
@@ -9,6 +9,7 @@
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/TypeTraits.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Time/Tags.hpp"
 #include "Utilities/TMPL.hpp"
@@ -18,6 +19,11 @@ namespace Tags {
 /*!
  * \brief Use the `AnalyticSolutionTag` to compute the analytic solution of the
  * tags in `AnalyticFieldsTagList`.
+ *
+ * If the solution is time-independent (see
+ * `evolution::is_time_independent_solution`) the tag doesn't depend on
+ * `::Tags::Time`, so the DataBox only recomputes it when the coordinates
+ * change.
  */
 template <size_t Dim, typename AnalyticSolutionTag,
           typename AnalyticFieldsTagList>
@@ -28,9 +34,13 @@ struct AnalyticCompute
   using base = db::add_tag_prefix<::Tags::Analytic,
                                   ::Tags::Variables<AnalyticFieldsTagList>>;
   using return_type = typename base::type;
-  using argument_tags =
+  using argument_tags = tmpl::conditional_t<
+      is_time_independent_solution_v<typename AnalyticSolutionTag::type>,
       tmpl::list<AnalyticSolutionTag,
-                 domain::Tags::Coordinates<Dim, Frame::Inertial>, ::Tags::Time>;
+                 domain::Tags::Coordinates<Dim, Frame::Inertial>>,
+      tmpl::list<AnalyticSolutionTag,
+                 domain::Tags::Coordinates<Dim, Frame::Inertial>,
+                 ::Tags::Time>>;
   static void function(
       const gsl::not_null<return_type*> analytic_solution,
       const typename AnalyticSolutionTag::type& analytic_solution_computer,
@@ -40,6 +50,15 @@ struct AnalyticCompute
         variables_from_tagged_tuple(analytic_solution_computer.variables(
             inertial_coords, time, AnalyticFieldsTagList{}));
   }
+
+  static void function(
+      const gsl::not_null<return_type*> analytic_solution,
+      const typename AnalyticSolutionTag::type& analytic_solution_computer,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>&
+          inertial_coords) noexcept {
+    function(analytic_solution, analytic_solution_computer, inertial_coords,
+             0.0);
+  }
 };
 
 // @{
@@ -10,6 +10,7 @@
 #include "Domain/Block.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/OptionTags.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -105,7 +106,9 @@ struct DgElementArray {
                      DgElementArray, ImportInitialData>::type>;
 
   using array_allocation_tags =
-      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>>;
+      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>,
+                 domain::Tags::InitialExtents<volume_dim>,
+                 domain::Tags::ElementPlacement>;
 
   using initialization_tags = Parallel::get_initialization_tags<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>,
@@ -155,17 +158,16 @@ void DgElementArray<Metavariables, PhaseDepActionList, ImportInitialData>::
   const auto& initial_refinement_levels =
       get<domain::Tags::InitialRefinementLevels<volume_dim>>(
           initialization_items);
-  int which_proc = 0;
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs = initial_refinement_levels[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    const int number_of_procs = Parallel::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementId<volume_dim>(element_ids[i]))
-          .insert(global_cache, initialization_items, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
+  const auto& initial_extents =
+      get<domain::Tags::InitialExtents<volume_dim>>(initialization_items);
+  const auto element_ids_and_procs = domain::element_distribution(
+      get<domain::Tags::ElementPlacement>(initialization_items),
+      domain.blocks(), initial_refinement_levels, initial_extents,
+      static_cast<size_t>(Parallel::number_of_procs()));
+  for (const auto& element_id_and_proc : element_ids_and_procs) {
+    dg_element_array(element_id_and_proc.first)
+        .insert(global_cache, initialization_items,
+                static_cast<int>(element_id_and_proc.second));
   }
   dg_element_array.doneInserting();
 }
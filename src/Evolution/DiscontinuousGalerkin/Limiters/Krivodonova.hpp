@@ -488,6 +488,10 @@ class Krivodonova<VolumeDim, tmpl::list<Tags...>> {
 
   bool operator==(const Krivodonova& rhs) const noexcept;
 
+  /// Whether the limiter was turned off with the `DisableForDebugging` option.
+  /// The limiter actions skip the neighbor communication in this case.
+  bool is_disabled() const noexcept { return disable_for_debugging_; }
+
   struct PackagedData {
     Variables<tmpl::list<::Tags::Modal<Tags>...>> modal_volume_data;
     Mesh<VolumeDim> mesh;
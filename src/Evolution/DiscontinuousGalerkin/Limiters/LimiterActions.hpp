@@ -18,6 +18,7 @@
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/InboxInserters.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/PerformanceCounters.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace Limiters {
@@ -52,6 +53,9 @@ namespace Actions {
 /// Currently, does not support:
 /// - Local time-stepping
 ///
+/// If the limiter is disabled (see e.g. `Limiters::Minmod::is_disabled`) no
+/// data is expected from the neighbors, so the action does not wait for them.
+///
 /// Uses:
 /// - ConstGlobalCache:
 ///   - Metavariables::limiter
@@ -64,6 +68,7 @@ namespace Actions {
 /// - Removes: nothing
 /// - Modifies:
 ///   - Metavariables::limiter::type::limit_tags
+///   - `Parallel::Tags::PerformanceCounters` (if present)
 ///
 /// \see SendDataForLimiter
 template <typename Metavariables>
@@ -94,8 +99,17 @@ struct Limit {
     const auto& local_temporal_id =
         db::get<typename Metavariables::temporal_id>(box);
     auto& inbox = tuples::get<limiter_comm_tag>(inboxes);
-    db::mutate_apply<mutate_tags, argument_tags>(limiter, make_not_null(&box),
-                                                 inbox[local_temporal_id]);
+    bool limiter_activated = false;
+    db::mutate_apply<mutate_tags, argument_tags>(
+        [&limiter, &limiter_activated](auto&&... args) noexcept {
+          limiter_activated = limiter(std::forward<decltype(args)>(args)...);
+        },
+        make_not_null(&box), inbox[local_temporal_id]);
+    if (limiter_activated) {
+      Parallel::increment_performance_counter(
+          make_not_null(&box),
+          Parallel::PerformanceCounter::LimiterActivations);
+    }
 
     inbox.erase(local_temporal_id);
 
@@ -106,13 +120,14 @@ struct Limit {
   static bool is_ready(
       const db::DataBox<DbTags>& box,
       const tuples::TaggedTuple<InboxTags...>& inboxes,
-      const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+      const Parallel::ConstGlobalCache<Metavariables>& cache,
       const ArrayIndex& /*array_index*/) noexcept {
     constexpr size_t volume_dim = Metavariables::system::volume_dim;
     const auto& element = db::get<domain::Tags::Element<volume_dim>>(box);
     const auto num_expected = element.neighbors().size();
-    // Edge case where we do not receive any data
-    if (UNLIKELY(num_expected == 0)) {
+    // Edge cases where we do not receive any data
+    if (UNLIKELY(num_expected == 0 or
+                 get<typename Metavariables::limiter>(cache).is_disabled())) {
       return true;
     }
     const auto& local_temporal_id =
@@ -139,6 +154,8 @@ struct Limit {
 /// Currently, does not support:
 /// - Local time-stepping
 ///
+/// Nothing is sent if the limiter is disabled.
+///
 /// Uses:
 /// - ConstGlobalCache:
 ///   - Metavariables::limiter
@@ -150,7 +167,8 @@ struct Limit {
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
-/// - Modifies: nothing
+/// - Modifies:
+///   - `Parallel::Tags::PerformanceCounters` (if present)
 ///
 /// \see ApplyLimiter
 template <typename Metavariables>
@@ -177,6 +195,9 @@ struct SendData {
     const auto& element = db::get<domain::Tags::Element<volume_dim>>(box);
     const auto& temporal_id = db::get<typename Metavariables::temporal_id>(box);
     const auto& limiter = get<typename Metavariables::limiter>(cache);
+    if (UNLIKELY(limiter.is_disabled())) {
+      return std::forward_as_tuple(std::move(box));
+    }
 
     for (const auto& direction_neighbors : element.neighbors()) {
       const auto& direction = direction_neighbors.first;
@@ -210,6 +231,9 @@ struct SendData {
 
       }  // loop over neighbors_in_direction
     }    // loop over element.neighbors()
+    Parallel::increment_performance_counter(
+        make_not_null(&box), Parallel::PerformanceCounter::MessagesSent,
+        element.number_of_neighbors());
 
     return std::forward_as_tuple(std::move(box));
   }
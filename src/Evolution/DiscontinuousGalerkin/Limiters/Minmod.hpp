@@ -213,6 +213,10 @@ class Minmod<VolumeDim, tmpl::list<Tags...>> {
   // clang-tidy: google-runtime-references
   void pup(PUP::er& p) noexcept;  // NOLINT
 
+  /// Whether the limiter was turned off with the `DisableForDebugging` option.
+  /// The limiter actions skip the neighbor communication in this case.
+  bool is_disabled() const noexcept { return disable_for_debugging_; }
+
   // To facilitate testing
   /// \cond
   MinmodType minmod_type() const noexcept { return minmod_type_; }
@@ -156,6 +156,10 @@ class Weno<VolumeDim, tmpl::list<Tags...>> {
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) noexcept;
 
+  /// Whether the limiter was turned off with the `DisableForDebugging` option.
+  /// The limiter actions skip the neighbor communication in this case.
+  bool is_disabled() const noexcept { return disable_for_debugging_; }
+
   /// \brief Data to send to neighbor elements
   struct PackagedData {
     Variables<tmpl::list<Tags...>> volume_data;
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <string>
+
 #include "AlgorithmSingleton.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "ErrorHandling/FloatingPointExceptions.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Components/CharacteristicEvolution.hpp"
@@ -24,6 +27,7 @@
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
@@ -100,7 +104,7 @@ struct EvolutionMetavars {
       "Perform Cauchy Characteristic Extraction using .h5 input data.\n"
       "Uses regularity-preserving formulation."};
 
-  enum class Phase { Initialization, Evolve, Exit };
+  DEFINE_PHASES(Initialization, Evolve, Exit)
 
   static Phase determine_next_phase(
       const Phase& current_phase,
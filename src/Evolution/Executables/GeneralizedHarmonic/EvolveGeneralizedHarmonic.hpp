@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 #include "AlgorithmSingleton.hpp"
@@ -67,6 +68,7 @@
 #include "Parallel/Actions/TerminatePhase.hpp"
 #include "Parallel/InitializationFunctions.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "ParallelAlgorithms/Actions/MutateApply.hpp"
@@ -77,6 +79,8 @@
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeMortars.hpp"
 #include "ParallelAlgorithms/Events/ObserveErrorNorms.hpp"
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "ParallelAlgorithms/Events/ObserveFieldsOnSlice.hpp"
+#include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
@@ -130,7 +134,7 @@ struct EvolutionMetavars {
   using system = GeneralizedHarmonic::System<volume_dim>;
   static constexpr bool use_damped_harmonic_rollon = true;
   using temporal_id = Tags::TimeStepId;
-  static constexpr bool local_time_stepping = false;
+  static constexpr bool local_time_stepping = true;
   using initial_data = InitialData;
   using boundary_conditions = BoundaryConditions;
   // Only Dirichlet boundary conditions imposed by an analytic solution are
@@ -233,6 +237,9 @@ struct EvolutionMetavars {
                                                 analytic_solution_fields>,
       dg::Events::Registrars::ObserveFields<
           volume_dim, Tags::Time, observe_fields, analytic_solution_fields>,
+      dg::Events::Registrars::ObserveFieldsOnSlice<volume_dim, Tags::Time,
+                                                   observe_fields>,
+      dg::Events::Registrars::ObserveTimeStep<volume_dim, Tags::Time>,
       Events::Registrars::ChangeSlabSize<slab_choosers>>;
   using triggers = Triggers::time_triggers;
 
@@ -277,16 +284,9 @@ struct EvolutionMetavars {
                                      Actions::RecordTimeStepperData<>>>,
       Actions::UpdateU<>>;
 
-  enum class Phase {
-    Initialization,
-    RegisterWithVolumeDataReader,
-    ImportInitialData,
-    InitializeInitialDataDependentQuantities,
-    InitializeTimeStepperHistory,
-    Register,
-    Evolve,
-    Exit
-  };
+  DEFINE_PHASES(Initialization, RegisterWithVolumeDataReader, ImportInitialData,
+                InitializeInitialDataDependentQuantities,
+                InitializeTimeStepperHistory, Register, Evolve, Exit)
 
   using initialization_actions = tmpl::list<
       Initialization::Actions::TimeAndTimeStep<EvolutionMetavars>,
@@ -385,9 +385,12 @@ struct EvolutionMetavars {
                              Parallel::Actions::TerminatePhase>>,
               Parallel::PhaseActions<
                   Phase, Phase::Evolve,
-                  tmpl::list<Actions::RunEventsAndTriggers,
-                             Actions::ChangeSlabSize, step_actions,
-                             Actions::AdvanceTime>>>>,
+                  tmpl::list<
+                      Actions::RunEventsAndTriggers, Actions::ChangeSlabSize,
+                      tmpl::conditional_t<
+                          local_time_stepping,
+                          Actions::ChangeStepSize<step_choosers>, tmpl::list<>>,
+                      step_actions, Actions::AdvanceTime>>>>,
           tmpl::conditional_t<
               evolution::is_numeric_initial_data_v<initial_data>,
               ImportNumericInitialData<Phase, Phase::ImportInitialData,
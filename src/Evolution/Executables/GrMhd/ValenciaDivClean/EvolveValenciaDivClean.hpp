@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "AlgorithmSingleton.hpp"
@@ -12,6 +13,7 @@
 #include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
 #include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
 #include "Domain/Tags.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "ErrorHandling/FloatingPointExceptions.hpp"
 #include "Evolution/Actions/AddMeshVelocitySourceTerms.hpp"
 #include "Evolution/Actions/ComputeTimeDerivative.hpp"  // IWYU pragma: keep
@@ -70,6 +72,7 @@
 #include "Parallel/Actions/TerminatePhase.hpp"
 #include "Parallel/InitializationFunctions.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "ParallelAlgorithms/Actions/MutateApply.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/CollectDataForFluxes.hpp"
@@ -79,11 +82,14 @@
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeMortars.hpp"
 #include "ParallelAlgorithms/Events/ObserveErrorNorms.hpp"
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "ParallelAlgorithms/Events/ObserveFieldsOnSlice.hpp"
+#include "ParallelAlgorithms/Events/ObservePerformanceCounters.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
 #include "ParallelAlgorithms/Initialization/Actions/AddComputeTags.hpp"
+#include "ParallelAlgorithms/Initialization/Actions/PerformanceCounters.hpp"
 #include "ParallelAlgorithms/Initialization/Actions/RemoveOptionsAndTerminatePhase.hpp"
 #include "PointwiseFunctions/AnalyticData/GrMhd/BondiHoyleAccretion.hpp"
 #include "PointwiseFunctions/AnalyticData/GrMhd/CylindricalBlastWave.hpp"
@@ -236,6 +242,13 @@ struct EvolutionMetavars {
                   typename system::primitive_variables_tag>>,
           tmpl::conditional_t<evolution::is_analytic_solution_v<initial_data>,
                               analytic_variables_tags, tmpl::list<>>>,
+      dg::Events::Registrars::ObserveFieldsOnSlice<
+          3, Tags::Time,
+          tmpl::append<
+              db::get_variables_tags_list<typename system::variables_tag>,
+              db::get_variables_tags_list<
+                  typename system::primitive_variables_tag>>>,
+      dg::Events::Registrars::ObservePerformanceCounters<3, Tags::Time>,
       Events::Registrars::ChangeSlabSize<slab_choosers>>>;
   using interpolation_events =
       tmpl::list<intrp::Events::Registrars::Interpolate<
@@ -286,13 +299,8 @@ struct EvolutionMetavars {
           grmhd::ValenciaDivClean::FixConservatives>,
       Actions::UpdatePrimitives>>;
 
-  enum class Phase {
-    Initialization,
-    InitializeTimeStepperHistory,
-    Register,
-    Evolve,
-    Exit
-  };
+  DEFINE_PHASES(Initialization, InitializeTimeStepperHistory, Register, Evolve,
+                Exit)
 
   using initialization_actions = tmpl::list<
       Initialization::Actions::TimeAndTimeStep<EvolutionMetavars>,
@@ -325,6 +333,7 @@ struct EvolutionMetavars {
       dg::Actions::InitializeMortars<boundary_scheme>,
       Initialization::Actions::DiscontinuousGalerkin<EvolutionMetavars>,
       Initialization::Actions::Minmod<3>,
+      Initialization::Actions::PerformanceCounters,
       Initialization::Actions::RemoveOptionsAndTerminatePhase>;
 
   using component_list = tmpl::list<
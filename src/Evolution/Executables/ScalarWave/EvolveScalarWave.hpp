@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -42,6 +43,7 @@
 #include "Parallel/Actions/TerminatePhase.hpp"
 #include "Parallel/InitializationFunctions.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "ParallelAlgorithms/Actions/MutateApply.hpp"
@@ -189,21 +191,16 @@ struct EvolutionMetavars {
                                      Actions::MutateApply<boundary_scheme>>,
                           tmpl::list<Actions::MutateApply<boundary_scheme>,
                                      Actions::RecordTimeStepperData<>>>,
-      Actions::UpdateU<>,
       tmpl::conditional_t<
           use_filtering,
-          dg::Actions::Filter<Filters::Exponential<0>,
-                              tmpl::list<ScalarWave::Pi, ScalarWave::Psi,
-                                         ScalarWave::Phi<Dim>>>,
-          tmpl::list<>>>>;
+          dg::Actions::UpdateUAndFilter<
+              Filters::Exponential<0>,
+              tmpl::list<ScalarWave::Pi, ScalarWave::Psi,
+                         ScalarWave::Phi<Dim>>>,
+          Actions::UpdateU<>>>>;
 
-  enum class Phase {
-    Initialization,
-    RegisterWithObserver,
-    InitializeTimeStepperHistory,
-    Evolve,
-    Exit
-  };
+  DEFINE_PHASES(Initialization, RegisterWithObserver,
+                InitializeTimeStepperHistory, Evolve, Exit)
 
   using initialization_actions = tmpl::list<
       Initialization::Actions::TimeAndTimeStep<EvolutionMetavars>,
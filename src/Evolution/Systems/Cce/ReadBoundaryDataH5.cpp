@@ -55,6 +55,34 @@ std::pair<size_t, size_t> create_span_for_time_value(
 
   return std::make_pair(span_start, span_end);
 }
+
+size_t retain_overlapping_rows(
+    const gsl::not_null<ComplexModalVector*> buffer,
+    const size_t previous_span_start, const size_t previous_span_end,
+    const size_t time_span_start, const size_t time_span_end) noexcept {
+  const size_t span_length = time_span_end - time_span_start;
+  if (span_length == 0 or
+      previous_span_end - previous_span_start != span_length or
+      time_span_start < previous_span_start or
+      time_span_start >= previous_span_end or
+      buffer->size() % span_length != 0) {
+    return 0;
+  }
+  const size_t offset = time_span_start - previous_span_start;
+  const size_t rows_retained = span_length - offset;
+  if (offset == 0) {
+    return rows_retained;
+  }
+  // the buffer is stored time-varies-fastest, so each mode is shifted
+  // independently toward the start of its contiguous block of time rows.
+  for (size_t mode_offset = 0; mode_offset < buffer->size();
+       mode_offset += span_length) {
+    std::copy(buffer->data() + mode_offset + offset,
+              buffer->data() + mode_offset + span_length,
+              buffer->data() + mode_offset);
+  }
+  return rows_retained;
+}
 }  // namespace detail
 
 SpecWorldtubeH5BufferUpdater::SpecWorldtubeH5BufferUpdater(
@@ -134,6 +162,8 @@ double SpecWorldtubeH5BufferUpdater::update_buffers_for_time(
   auto new_span_pair = detail::create_span_for_time_value(
       time, buffer_depth, interpolator_length, 0, time_buffer_.size(),
       time_buffer_);
+  const size_t previous_span_start = *time_span_start;
+  const size_t previous_span_end = *time_span_end;
   *time_span_start = new_span_pair.first;
   *time_span_end = new_span_pair.second;
   // load the desired time spans into the buffers
@@ -144,14 +174,15 @@ double SpecWorldtubeH5BufferUpdater::update_buffers_for_time(
                                 Tags::detail::Dr<Tags::detail::SpatialMetric>,
                                 ::Tags::dt<Tags::detail::SpatialMetric>>>([
         this, &i, &j, &buffers, &time_span_start, &time_span_end, &
-        computation_l_max
+        computation_l_max, &previous_span_start, &previous_span_end
       ](auto tag_v) noexcept {
         using tag = typename decltype(tag_v)::type;
         this->update_buffer(
             make_not_null(&get<tag>(*buffers).get(i, j)),
             cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
                 get<Tags::detail::InputDataSet<tag>>(dataset_names_), i, j)),
-            computation_l_max, *time_span_start, *time_span_end);
+            computation_l_max, *time_span_start, *time_span_end,
+            previous_span_start, previous_span_end);
         cce_data_file_.close_current_object();
       });
     }
@@ -159,14 +190,16 @@ double SpecWorldtubeH5BufferUpdater::update_buffers_for_time(
     tmpl::for_each<
         tmpl::list<Tags::detail::Shift, Tags::detail::Dr<Tags::detail::Shift>,
                    ::Tags::dt<Tags::detail::Shift>>>([
-      this, &i, &buffers, &time_span_start, &time_span_end, &computation_l_max
+      this, &i, &buffers, &time_span_start, &time_span_end, &computation_l_max,
+      &previous_span_start, &previous_span_end
     ](auto tag_v) noexcept {
       using tag = typename decltype(tag_v)::type;
       this->update_buffer(
           make_not_null(&get<tag>(*buffers).get(i)),
           cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
               get<Tags::detail::InputDataSet<tag>>(dataset_names_), i)),
-          computation_l_max, *time_span_start, *time_span_end);
+          computation_l_max, *time_span_start, *time_span_end,
+          previous_span_start, previous_span_end);
       cce_data_file_.close_current_object();
     });
   }
@@ -174,14 +207,16 @@ double SpecWorldtubeH5BufferUpdater::update_buffers_for_time(
   tmpl::for_each<
       tmpl::list<Tags::detail::Lapse, Tags::detail::Dr<Tags::detail::Lapse>,
                  ::Tags::dt<Tags::detail::Lapse>>>([
-    this, &buffers, &time_span_start, &time_span_end, &computation_l_max
+    this, &buffers, &time_span_start, &time_span_end, &computation_l_max,
+    &previous_span_start, &previous_span_end
   ](auto tag_v) noexcept {
     using tag = typename decltype(tag_v)::type;
     this->update_buffer(
         make_not_null(&get(get<tag>(*buffers))),
         cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
             get<Tags::detail::InputDataSet<tag>>(dataset_names_))),
-        computation_l_max, *time_span_start, *time_span_end);
+        computation_l_max, *time_span_start, *time_span_end,
+        previous_span_start, previous_span_end);
     cce_data_file_.close_current_object();
   });
   // the next time an update will be required
@@ -215,32 +250,49 @@ void SpecWorldtubeH5BufferUpdater::pup(PUP::er& p) noexcept {
 void SpecWorldtubeH5BufferUpdater::update_buffer(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
     const h5::Dat& read_data, const size_t computation_l_max,
-    const size_t time_span_start, const size_t time_span_end) const noexcept {
+    const size_t time_span_start, const size_t time_span_end,
+    const size_t previous_span_start,
+    const size_t previous_span_end) const noexcept {
   const size_t number_of_columns = read_data.get_dimensions()[1];
-  if (UNLIKELY(buffer_to_update->size() != (time_span_end - time_span_start) *
-                                               square(computation_l_max + 1))) {
+  const size_t span_length = time_span_end - time_span_start;
+  if (UNLIKELY(buffer_to_update->size() !=
+               span_length * square(computation_l_max + 1))) {
     ERROR("Incorrect storage size for the data to be loaded in.");
   }
-  auto cols = alg::iota(std::vector<size_t>(number_of_columns - 1), 1_st);
+  // rows shared with the previous span are moved rather than read again
+  const size_t rows_retained = detail::retain_overlapping_rows(
+      buffer_to_update, previous_span_start, previous_span_end,
+      time_span_start, time_span_end);
+  if (rows_retained == span_length) {
+    return;
+  }
+  // only the columns for modes that are used by the computation are read
+  const size_t loaded_l_max = std::min(computation_l_max, l_max_);
+  auto cols = alg::iota(
+      std::vector<size_t>(
+          std::min(2 * square(loaded_l_max + 1), number_of_columns - 1)),
+      1_st);
   const Matrix data_matrix = read_data.get_data_subset(
-      cols, time_span_start, time_span_end - time_span_start);
+      cols, time_span_start + rows_retained, span_length - rows_retained);
 
-  *buffer_to_update = 0.0;
-  for (size_t time_row = 0; time_row < time_span_end - time_span_start;
-       ++time_row) {
-    for (int l = 0; l <= static_cast<int>(std::min(computation_l_max, l_max_));
-         ++l) {
+  for (size_t mode = 0; mode < square(computation_l_max + 1); ++mode) {
+    std::fill(buffer_to_update->data() + mode * span_length + rows_retained,
+              buffer_to_update->data() + (mode + 1) * span_length, 0.0);
+  }
+  for (size_t time_row = rows_retained; time_row < span_length; ++time_row) {
+    const size_t data_row = time_row - rows_retained;
+    for (int l = 0; l <= static_cast<int>(loaded_l_max); ++l) {
       for (int m = -l; m <= l; ++m) {
         (*buffer_to_update)[Spectral::Swsh::goldberg_mode_index(
                                 computation_l_max, static_cast<size_t>(l), m) *
-                                (time_span_end - time_span_start) +
+                                span_length +
                             time_row] =
             // -m because SpEC format is stored in decending m.
             std::complex<double>(
-                data_matrix(time_row,
+                data_matrix(data_row,
                             2 * Spectral::Swsh::goldberg_mode_index(
                                     l_max_, static_cast<size_t>(l), -m)),
-                data_matrix(time_row,
+                data_matrix(data_row,
                             2 * Spectral::Swsh::goldberg_mode_index(
                                     l_max_, static_cast<size_t>(l), -m) +
                                 1));
@@ -322,11 +374,14 @@ double ReducedSpecWorldtubeH5BufferUpdater::update_buffers_for_time(
   auto new_span_pair = detail::create_span_for_time_value(
       time, buffer_depth, interpolator_length, 0, time_buffer_.size(),
       time_buffer_);
+  const size_t previous_span_start = *time_span_start;
+  const size_t previous_span_end = *time_span_end;
   *time_span_start = new_span_pair.first;
   *time_span_end = new_span_pair.second;
   // load the desired time spans into the buffers
   tmpl::for_each<detail::reduced_cce_input_tags>([
-    this, &buffers, &time_span_start, &time_span_end, &computation_l_max
+    this, &buffers, &time_span_start, &time_span_end, &computation_l_max,
+    &previous_span_start, &previous_span_end
   ](auto tag_v) noexcept {
     using tag = typename decltype(tag_v)::type;
     this->update_buffer(
@@ -334,7 +389,7 @@ double ReducedSpecWorldtubeH5BufferUpdater::update_buffers_for_time(
         cce_data_file_.get<h5::Dat>(
             "/" + get<Tags::detail::InputDataSet<tag>>(dataset_names_)),
         computation_l_max, *time_span_start, *time_span_end,
-        tag::type::type::spin == 0);
+        previous_span_start, previous_span_end, tag::type::type::spin == 0);
     cce_data_file_.close_current_object();
   });
   // the next time an update will be required
@@ -346,69 +401,84 @@ void ReducedSpecWorldtubeH5BufferUpdater::update_buffer(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
     const h5::Dat& read_data, const size_t computation_l_max,
     const size_t time_span_start, const size_t time_span_end,
+    const size_t previous_span_start, const size_t previous_span_end,
     const bool is_real) const noexcept {
   size_t number_of_columns = read_data.get_dimensions()[1];
+  const size_t span_length = time_span_end - time_span_start;
   if (UNLIKELY(buffer_to_update->size() !=
-               square(computation_l_max + 1) *
-                   (time_span_end - time_span_start))) {
+               square(computation_l_max + 1) * span_length)) {
     ERROR("Incorrect storage size for the data to be loaded in.");
   }
-  std::vector<size_t> cols(number_of_columns - 1);
+  // rows shared with the previous span are moved rather than read again
+  const size_t rows_retained = detail::retain_overlapping_rows(
+      buffer_to_update, previous_span_start, previous_span_end,
+      time_span_start, time_span_end);
+  if (rows_retained == span_length) {
+    return;
+  }
+  // only the columns for modes that are used by the computation are read
+  const size_t loaded_l_max = std::min(computation_l_max, l_max_);
+  std::vector<size_t> cols(
+      std::min((is_real ? 1 : 2) * square(loaded_l_max + 1),
+               number_of_columns - 1));
   std::iota(cols.begin(), cols.end(), 1);
   Matrix data_matrix = read_data.get_data_subset(
-      cols, time_span_start, time_span_end - time_span_start);
-  *buffer_to_update = 0.0;
-  for (size_t time_row = 0; time_row < time_span_end - time_span_start;
-       ++time_row) {
-    for (int l = 0; l <= static_cast<int>(std::min(computation_l_max, l_max_));
-         ++l) {
+      cols, time_span_start + rows_retained, span_length - rows_retained);
+  for (size_t mode = 0; mode < square(computation_l_max + 1); ++mode) {
+    std::fill(buffer_to_update->data() + mode * span_length + rows_retained,
+              buffer_to_update->data() + (mode + 1) * span_length, 0.0);
+  }
+  for (size_t time_row = rows_retained; time_row < span_length; ++time_row) {
+    const size_t data_row = time_row - rows_retained;
+    for (int l = 0; l <= static_cast<int>(loaded_l_max); ++l) {
       for (int m = -l; m <= l; ++m) {
         if (is_real) {
           if (m == 0) {
             (*buffer_to_update)[Spectral::Swsh::goldberg_mode_index(
                                     computation_l_max, static_cast<size_t>(l),
                                     m) *
-                                    (time_span_end - time_span_start) +
+                                    span_length +
                                 time_row] =
                 std::complex<double>(
-                    data_matrix(time_row, static_cast<size_t>(square(l))), 0.0);
+                    data_matrix(data_row, static_cast<size_t>(square(l))),
+                    0.0);
           } else if (m > 0) {
             (*buffer_to_update)[Spectral::Swsh::goldberg_mode_index(
                                     computation_l_max, static_cast<size_t>(l),
                                     m) *
-                                    (time_span_end - time_span_start) +
+                                    span_length +
                                 time_row] =
                 std::complex<double>(
-                    data_matrix(time_row,
+                    data_matrix(data_row,
                                 static_cast<size_t>(square(l) + 2 * m - 1)),
                     data_matrix(
-                        time_row,
+                        data_row,
                         static_cast<size_t>(square(l) + 2 * m)));  // NOLINT
           } else {
             (*buffer_to_update)[Spectral::Swsh::goldberg_mode_index(
                                     computation_l_max, static_cast<size_t>(l),
                                     m) *
-                                    (time_span_end - time_span_start) +
+                                    span_length +
                                 time_row] =
                 (-m % 2 == 0 ? 1.0 : -1.0) *
                 std::complex<double>(
-                    data_matrix(time_row,
+                    data_matrix(data_row,
                                 static_cast<size_t>(square(l) + 2 * -m - 1)),
                     -data_matrix(
-                        time_row,
+                        data_row,
                         static_cast<size_t>(square(l) + 2 * -m)));  // NOLINT
           }
         } else {
           (*buffer_to_update)[Spectral::Swsh::goldberg_mode_index(
                                   computation_l_max, static_cast<size_t>(l),
                                   m) *
-                                  (time_span_end - time_span_start) +
+                                  span_length +
                               time_row] =
               std::complex<double>(
-                  data_matrix(time_row,
+                  data_matrix(data_row,
                               2 * Spectral::Swsh::goldberg_mode_index(
                                       l_max_, static_cast<size_t>(l), m)),
-                  data_matrix(time_row,
+                  data_matrix(data_row,
                               2 * Spectral::Swsh::goldberg_mode_index(
                                       l_max_, static_cast<size_t>(l), m) +
                                   1));
@@ -104,6 +104,17 @@ using reduced_cce_input_tags =
 std::pair<size_t, size_t> create_span_for_time_value(
     double time, size_t pad, size_t interpolator_length, size_t lower_bound,
     size_t upper_bound, const DataVector& time_buffer) noexcept;
+
+// Moves the time rows of the mode-major `buffer` that are shared between the
+// previous span [`previous_span_start`, `previous_span_end`) and the new span
+// [`time_span_start`, `time_span_end`) to their location for the new span, and
+// returns the number of rows retained at the start of each mode. Only the
+// remaining rows then need to be read from disk. The rows can only be reused
+// when the span moves forward without changing its length.
+size_t retain_overlapping_rows(gsl::not_null<ComplexModalVector*> buffer,
+                               size_t previous_span_start,
+                               size_t previous_span_end, size_t time_span_start,
+                               size_t time_span_end) noexcept;
 }  // namespace detail
 
 /// \cond
@@ -233,8 +244,9 @@ class SpecWorldtubeH5BufferUpdater : public WorldtubeBufferUpdater {
  private:
   void update_buffer(gsl::not_null<ComplexModalVector*> buffer_to_update,
                      const h5::Dat& read_data, size_t computation_l_max,
-                     size_t time_span_start, size_t time_span_end) const
-      noexcept;
+                     size_t time_span_start, size_t time_span_end,
+                     size_t previous_span_start,
+                     size_t previous_span_end) const noexcept;
 
   bool radial_derivatives_need_renormalization_ = false;
   double extraction_radius_ = 1.0;
@@ -346,6 +358,7 @@ class ReducedSpecWorldtubeH5BufferUpdater
   void update_buffer(gsl::not_null<ComplexModalVector*> buffer_to_update,
                      const h5::Dat& read_data, size_t computation_l_max,
                      size_t time_span_start, size_t time_span_end,
+                     size_t previous_span_start, size_t previous_span_end,
                      bool is_real) const noexcept;
 
   double extraction_radius_ = 1.0;
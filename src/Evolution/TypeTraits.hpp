@@ -35,6 +35,26 @@ template <typename T>
 constexpr bool is_analytic_solution_v =
     std::is_convertible_v<T*, MarkAsAnalyticSolution*>;
 
+// @{
+/// \ingroup AnalyticSolutionsGroup
+/// Checks if the analytic solution `T` is independent of time, which it
+/// declares with a `static constexpr bool is_time_independent = true` member.
+/// Quantities computed from such a solution only change with the coordinates.
+template <typename T, typename = std::void_t<>>
+struct is_time_independent_solution : std::false_type {};
+
+/// \cond
+template <typename T>
+struct is_time_independent_solution<
+    T, std::void_t<decltype(T::is_time_independent)>>
+    : std::bool_constant<T::is_time_independent> {};
+/// \endcond
+
+template <typename T>
+constexpr bool is_time_independent_solution_v =
+    is_time_independent_solution<T>::value;
+// @}
+
 // @{
 /// Helper metafunction that checks if the class `T` is marked as numeric
 /// initial data.
@@ -16,6 +16,7 @@
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/Printf.hpp"
 #include "Utilities/TMPL.hpp"
 /// [executable_example_includes]
@@ -90,7 +91,7 @@ struct Metavars {
   static constexpr OptionString help{
       "Say hello from a singleton parallel component."};
 
-  enum class Phase { Initialization, Execute, Exit };
+  DEFINE_PHASES(Initialization, Execute, Exit)
 
   static Phase determine_next_phase(const Phase& current_phase,
                                     const Parallel::CProxy_ConstGlobalCache<
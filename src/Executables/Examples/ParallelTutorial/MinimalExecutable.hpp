@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Options/Options.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace Parallel {
@@ -17,7 +18,7 @@ class CProxy_ConstGlobalCache;
 struct Metavariables {
   using component_list = tmpl::list<>;
 
-  enum class Phase { Initialization, Exit };
+  DEFINE_PHASES(Initialization, Exit)
 
   static Phase determine_next_phase(
       const Phase& /*current_phase*/,
@@ -12,6 +12,7 @@
 #include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "ErrorHandling/FloatingPointExceptions.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
@@ -30,6 +31,7 @@
 #include "Parallel/InitializationFunctions.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/PhaseNames.hpp"
 #include "Parallel/Printf.hpp"
 #include "Parallel/RegisterDerivedClassesWithCharm.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"
@@ -133,7 +135,7 @@ struct Metavariables {
       "diagnostic of Domain quality: values far from unity indicate "
       "compression or expansion of the grid."};
 
-  enum class Phase { Initialization, RegisterWithObserver, Export, Exit };
+  DEFINE_PHASES(Initialization, RegisterWithObserver, Export, Exit)
 
   using component_list = tmpl::list<
       DgElementArray<
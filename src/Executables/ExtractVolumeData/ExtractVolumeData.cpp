@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ErrorHandling/Error.hpp"
+#include "IO/H5/ExtractVolumeData.hpp"
+#include "Parallel/Exit.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/FileSystem.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+namespace {
+// The H5 files whose names start with `file_prefix`, in the directory of the
+// prefix
+std::vector<std::string> h5_files_with_prefix(
+    const std::string& file_prefix) noexcept {
+  const std::string directory = file_system::get_parent_path(file_prefix);
+  const std::string name_prefix = file_system::get_file_name(file_prefix);
+  std::vector<std::string> h5_file_names{};
+  for (const auto& file_name : file_system::ls(directory)) {
+    if (file_name.size() >= name_prefix.size() + 3 and
+        file_name.compare(0, name_prefix.size(), name_prefix) == 0 and
+        file_name.compare(file_name.size() - 3, 3, ".h5") == 0) {
+      h5_file_names.push_back(
+          file_prefix.find('/') == std::string::npos
+              ? file_name
+              : directory + "/" + file_name);
+    }
+  }
+  std::sort(h5_file_names.begin(), h5_file_names.end());
+  return h5_file_names;
+}
+}  // namespace
+
+/*
+ * This executable merges the volume data that the nodes of a run wrote to
+ * separate H5 files into one H5 file per observation, keeping only the
+ * requested tensor components, grids and times. Several instances can share
+ * the work by writing different parts of the observations.
+ */
+int main(int argc, char** argv) {
+  boost::program_options::options_description desc("Options");
+  desc.add_options()("help", "show this help message")(
+      "file-prefix", boost::program_options::value<std::string>()->required(),
+      "the common prefix of the H5 volume files to load")(
+      "output-prefix",
+      boost::program_options::value<std::string>()->required(),
+      "the prefix of the output files, which are numbered by observation")(
+      "subfile-name",
+      boost::program_options::value<std::string>()->default_value(
+          "/element_data"),
+      "the volume data subfile in the H5 files")(
+      "tensor-components",
+      boost::program_options::value<std::vector<std::string>>()
+          ->multitoken()
+          ->default_value(std::vector<std::string>{}, ""),
+      "the tensor components to extract, all of them if none are given")(
+      "grid-name-filter",
+      boost::program_options::value<std::string>()->default_value(""),
+      "extract only the grids whose names contain this string")(
+      "start-time",
+      boost::program_options::value<double>()->default_value(
+          std::numeric_limits<double>::lowest()),
+      "the earliest time to extract (included)")(
+      "stop-time",
+      boost::program_options::value<double>()->default_value(1.0e300),
+      "the latest time to extract (included)")(
+      "number-of-parts",
+      boost::program_options::value<size_t>()->default_value(1),
+      "the number of parts the observations are split into")(
+      "part", boost::program_options::value<size_t>()->default_value(0),
+      "the part of the observations to extract, in [0, number-of-parts)");
+
+  boost::program_options::variables_map vars;
+  boost::program_options::store(
+      boost::program_options::command_line_parser(argc, argv)
+          .options(desc)
+          .run(),
+      vars);
+
+  if (vars.count("help") != 0u) {
+    Parallel::printf("%s\n", desc);
+    Parallel::exit();
+  }
+  boost::program_options::notify(vars);
+
+  const auto& file_prefix = vars["file-prefix"].as<std::string>();
+  const auto& output_prefix = vars["output-prefix"].as<std::string>();
+  auto h5_file_names = h5_files_with_prefix(file_prefix);
+  // Don't read the output of a previous extraction
+  const auto output_file_names = h5_files_with_prefix(output_prefix);
+  h5_file_names.erase(
+      std::remove_if(h5_file_names.begin(), h5_file_names.end(),
+                     [&output_file_names](const std::string& name) noexcept {
+                       return std::find(output_file_names.begin(),
+                                        output_file_names.end(),
+                                        name) != output_file_names.end();
+                     }),
+      h5_file_names.end());
+  if (h5_file_names.empty()) {
+    ERROR("No H5 files with prefix '" << file_prefix << "' found.");
+  }
+  if (vars["part"].as<size_t>() >= vars["number-of-parts"].as<size_t>()) {
+    ERROR("The part must be smaller than the number of parts.");
+  }
+  h5::extract_volume_data(
+      h5_file_names, vars["subfile-name"].as<std::string>(), output_prefix,
+      vars["tensor-components"].as<std::vector<std::string>>(),
+      vars["grid-name-filter"].as<std::string>(),
+      vars["start-time"].as<double>(), vars["stop-time"].as<double>(),
+      vars["number-of-parts"].as<size_t>(), vars["part"].as<size_t>());
+}
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ErrorHandling/Error.hpp"
+#include "IO/H5/Xdmf.hpp"
+#include "Parallel/Exit.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/FileSystem.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+namespace {
+// The H5 files whose names start with `file_prefix`, in the directory of the
+// prefix
+std::vector<std::string> h5_files_with_prefix(
+    const std::string& file_prefix) noexcept {
+  const std::string directory = file_system::get_parent_path(file_prefix);
+  const std::string name_prefix = file_system::get_file_name(file_prefix);
+  std::vector<std::string> h5_file_names{};
+  for (const auto& file_name : file_system::ls(directory)) {
+    if (file_name.size() >= name_prefix.size() + 3 and
+        file_name.compare(0, name_prefix.size(), name_prefix) == 0 and
+        file_name.compare(file_name.size() - 3, 3, ".h5") == 0) {
+      h5_file_names.push_back(
+          file_prefix.find('/') == std::string::npos
+              ? file_name
+              : directory + "/" + file_name);
+    }
+  }
+  std::sort(h5_file_names.begin(), h5_file_names.end());
+  return h5_file_names;
+}
+}  // namespace
+
+/*
+ * This executable writes an XDMF file that ParaView and VisIt can use to load
+ * the volume data in H5 files written by the observers. It is a faster
+ * replacement for `GenerateXdmf.py`, for runs where the XDMF files written
+ * during the run are not available or only a subset of the data is needed.
+ */
+int main(int argc, char** argv) {
+  boost::program_options::options_description desc("Options");
+  desc.add_options()("help", "show this help message")(
+      "file-prefix", boost::program_options::value<std::string>()->required(),
+      "the common prefix of the H5 volume files to load")(
+      "output", boost::program_options::value<std::string>()->required(),
+      "output file name, an xmf extension will be added")(
+      "subfile-name",
+      boost::program_options::value<std::string>()->default_value(
+          "/element_data"),
+      "the volume data subfile in the H5 files")(
+      "stride", boost::program_options::value<size_t>()->default_value(1),
+      "view only every stride'th observation")(
+      "start-time", boost::program_options::value<double>()->default_value(0.0),
+      "the earliest time at which to start visualizing (included)")(
+      "stop-time",
+      boost::program_options::value<double>()->default_value(1.0e300),
+      "the latest time at which to visualize (included)")(
+      "coordinates",
+      boost::program_options::value<std::string>()->default_value(
+          "InertialCoordinates"),
+      "the coordinates to use for visualization");
+
+  boost::program_options::variables_map vars;
+  boost::program_options::store(
+      boost::program_options::command_line_parser(argc, argv)
+          .options(desc)
+          .run(),
+      vars);
+
+  if (vars.count("help") != 0u) {
+    Parallel::printf("%s\n", desc);
+    Parallel::exit();
+  }
+  boost::program_options::notify(vars);
+
+  const auto& file_prefix = vars["file-prefix"].as<std::string>();
+  const auto h5_file_names = h5_files_with_prefix(file_prefix);
+  if (h5_file_names.empty()) {
+    ERROR("No H5 files with prefix '" << file_prefix << "' found.");
+  }
+  if (vars["stride"].as<size_t>() == 0) {
+    ERROR("The stride must be positive.");
+  }
+  h5::write_xdmf_file(vars["output"].as<std::string>() + ".xmf",
+                      h5_file_names, vars["subfile-name"].as<std::string>(),
+                      vars["coordinates"].as<std::string>(),
+                      vars["start-time"].as<double>(),
+                      vars["stop-time"].as<double>(),
+                      vars["stride"].as<size_t>());
+}
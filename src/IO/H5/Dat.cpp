@@ -132,14 +132,13 @@ void Dat::append_impl(const hsize_t number_of_rows,
            "Failed to append to the file '" << name_ << "'");
   const hid_t dataspace_id = H5Dget_space(dataset_id_);
   CHECK_H5(dataspace_id, "Failed to get dataspace for appending");
-  CHECK_H5(H5Sselect_all(dataspace_id),
-           "Failed to select dataspace for appending");
-  CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_NOTB,
-                               std::array<hsize_t, 2>{{0, 0}}.data(), nullptr,
-                               size_.data(), nullptr),
+  // Select only the new rows at the end of the dataset as a single block.
+  const std::array<hsize_t, 2> start{{size_[0], 0}};
+  const std::array<hsize_t, 2> added_size{{number_of_rows, size_[1]}};
+  CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_SET, start.data(),
+                               nullptr, added_size.data(), nullptr),
            "Failed to select the new dataspace subset where the appended "
            "data would have been written.");
-  const std::array<hsize_t, 2> added_size{{number_of_rows, size_[1]}};
   const hid_t memspace_id =
       H5Screate_simple(2, added_size.data(), added_size.data());
   CHECK_H5(memspace_id, "Failed to create new simple memspace while appending");
@@ -169,16 +168,15 @@ void Dat::append(const std::vector<std::vector<double>>& data) {
   }
   const std::vector<double> contiguous_data =
       [](const std::vector<std::vector<double>>& ldata) {
-        std::vector<double> result(ldata.size() * ldata[0].size());
+        std::vector<double> result{};
+        result.reserve(ldata.size() * ldata[0].size());
         for (size_t i = 0; i < ldata.size(); ++i) {
           if (ldata[i].size() != ldata[0].size()) {
             ERROR(
                 "Each member of the vector<vector<double>> must be of the same "
                 "size, ie the number of columns must be the same.");
           }
-          result.insert(
-              result.begin() + static_cast<std::ptrdiff_t>(i * ldata[i].size()),
-              ldata[i].begin(), ldata[i].end());
+          result.insert(result.end(), ldata[i].begin(), ldata[i].end());
         }
         return result;
       }(data);
@@ -264,23 +262,39 @@ Matrix Dat::get_data_subset(const std::vector<size_t>& these_columns,
              "the same time it is being read.");
   }
 
+  // HDF5 reads a union of hyperslabs in the order the elements are stored in
+  // the file, so we read the sorted unique columns and reorder them below.
+  // Adjacent columns are selected as a single block.
+  std::vector<size_t> sorted_columns = these_columns;
+  std::sort(sorted_columns.begin(), sorted_columns.end());
+  sorted_columns.erase(
+      std::unique(sorted_columns.begin(), sorted_columns.end()),
+      sorted_columns.end());
+  const auto num_unique_cols = sorted_columns.size();
+
   CHECK_H5(H5Sselect_none(dataspace_id),
            "Failed to select none of the dataspace");
-  for (auto& column : these_columns) {
+  for (size_t i = 0; i < num_unique_cols;) {
+    size_t block_width = 1;
+    while (i + block_width < num_unique_cols and
+           sorted_columns[i + block_width] == sorted_columns[i] + block_width) {
+      ++block_width;
+    }
     const std::array<hsize_t, 2> start{
-        {first_row, static_cast<hsize_t>(column)}};
+        {first_row, static_cast<hsize_t>(sorted_columns[i])}};
     // offset between blocks (have only one anyway)
     const std::array<hsize_t, 2> stride{{1, 1}};
     const std::array<hsize_t, 2> count{{1, 1}};
-    const std::array<hsize_t, 2> block{{num_rows, 1}};
+    const std::array<hsize_t, 2> block{{num_rows, block_width}};
 
     CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, start.data(),
                                  stride.data(), count.data(), block.data()),
-             "Failed to select column " << column);
+             "Failed to select columns starting at " << sorted_columns[i]);
+    i += block_width;
   }
 
-  std::vector<double> raw_data(num_rows * num_cols);
-  const std::array<hsize_t, 2> memspace_size{{num_rows, num_cols}};
+  std::vector<double> raw_data(num_rows * num_unique_cols);
+  const std::array<hsize_t, 2> memspace_size{{num_rows, num_unique_cols}};
   const hid_t memspace_id =
       H5Screate_simple(2, memspace_size.data(), memspace_size.data());
   CHECK_H5(memspace_id, "Failed to create memory space");
@@ -290,7 +304,17 @@ Matrix Dat::get_data_subset(const std::vector<size_t>& these_columns,
 
   CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
   CHECK_H5(H5Sclose(dataspace_id), "Failed to close dataspace");
-  return vector_to_matrix(raw_data,
-                          std::array<hsize_t, 2>{{num_rows, num_cols}});
+
+  Matrix result(num_rows, num_cols);
+  for (size_t j = 0; j < num_cols; ++j) {
+    const auto unique_column = static_cast<size_t>(
+        std::lower_bound(sorted_columns.begin(), sorted_columns.end(),
+                         these_columns[j]) -
+        sorted_columns.begin());
+    for (size_t i = 0; i < num_rows; ++i) {
+      result(i, j) = raw_data[unique_column + i * num_unique_cols];
+    }
+  }
+  return result;
 }
 }  // namespace h5
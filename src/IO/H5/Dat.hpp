@@ -94,7 +94,10 @@ class Dat : public h5::Object {
    * \requires all members of `these_columns` have a value less than the number
    * of columns, `first_row < last_row` and `last_row` is less than or equal to
    * the number of rows
-   * \returns a subset of the data from the Dat file
+   * \returns a subset of the data from the Dat file, with the columns in the
+   * order given by `these_columns`
+   *
+   * Only the requested rows and columns are read from disk.
    *
    * \example
    * \snippet Test_H5.cpp h5dat_get_subset
@@ -0,0 +1,130 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/ExtractVolumeData.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataFiles.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Numeric.hpp"
+
+/// \cond HIDDEN_SYMBOLS
+namespace h5 {
+std::vector<std::string> extract_volume_data(
+    const std::vector<std::string>& h5_file_names,
+    const std::string& subfile_name, const std::string& output_file_prefix,
+    const std::vector<std::string>& tensor_components,
+    const std::string& grid_name_filter, const double start_value,
+    const double stop_value, const size_t number_of_parts,
+    const size_t part) noexcept {
+  if (h5_file_names.empty()) {
+    ERROR("No H5 files to extract volume data from.");
+  }
+  if (part >= number_of_parts) {
+    ERROR("Cannot write part " << part << " of " << number_of_parts
+                               << " parts.");
+  }
+  const VolumeDataFiles volume_files(h5_file_names, subfile_name);
+  const auto values_and_ids =
+      volume_files.observations(start_value, stop_value);
+
+  std::vector<std::string> output_file_names{};
+  for (size_t i = part; i < values_and_ids.size(); i += number_of_parts) {
+    const double observation_value = values_and_ids[i].first;
+    const size_t observation_id = values_and_ids[i].second;
+    std::vector<ExtentsAndTensorVolumeData> elements{};
+    uint32_t version = 0;
+    for (size_t f = 0; f < volume_files.size(); ++f) {
+      if (not volume_files.has_observation(f, observation_id)) {
+        continue;
+      }
+      const auto& volume_file = volume_files.volume_file(f);
+      version = volume_file.get_version();
+      const auto all_grid_names = volume_file.get_grid_names(observation_id);
+      const auto all_extents = volume_file.get_extents(observation_id);
+      // The selected grids and their offsets and lengths in the datasets,
+      // which are the same for all tensor components
+      std::vector<std::string> grid_names{};
+      std::vector<size_t> grid_indices{};
+      std::vector<std::pair<size_t, size_t>> offsets_and_lengths{};
+      size_t offset = 0;
+      for (size_t g = 0; g < all_grid_names.size(); ++g) {
+        const size_t length =
+            alg::accumulate(all_extents[g], size_t{1}, std::multiplies<>{});
+        if (all_grid_names[g].find(grid_name_filter) != std::string::npos) {
+          grid_names.push_back(all_grid_names[g]);
+          grid_indices.push_back(g);
+          offsets_and_lengths.emplace_back(offset, length);
+        }
+        offset += length;
+      }
+      if (grid_names.empty()) {
+        continue;
+      }
+      const auto all_components =
+          volume_file.list_tensor_components(observation_id);
+      const auto& components =
+          tensor_components.empty() ? all_components : tensor_components;
+
+      const size_t first_element = elements.size();
+      for (const size_t g : grid_indices) {
+        elements.emplace_back(all_extents[g], std::vector<TensorComponent>{});
+        elements.back().tensor_components.reserve(components.size());
+      }
+      for (const auto& component : components) {
+        if (not alg::found(all_components, component)) {
+          ERROR("No tensor component '" << component << "' found in '"
+                                        << h5_file_names[f] << "'.");
+        }
+        // Only the data of the selected grids is read
+        const DataVector data =
+            grid_names.size() == all_grid_names.size()
+                ? volume_file.get_tensor_component(observation_id, component)
+                : volume_file.get_tensor_component(observation_id, component,
+                                                   offsets_and_lengths);
+        size_t data_offset = 0;
+        for (size_t k = 0; k < grid_indices.size(); ++k) {
+          const size_t number_of_points = offsets_and_lengths[k].second;
+          DataVector grid_data(number_of_points);
+          std::copy(
+              data.begin() + static_cast<std::ptrdiff_t>(data_offset),
+              data.begin() +
+                  static_cast<std::ptrdiff_t>(data_offset + number_of_points),
+              grid_data.begin());
+          elements[first_element + k].tensor_components.emplace_back(
+              grid_names[k] + "/" + component, std::move(grid_data));
+          data_offset += number_of_points;
+        }
+      }
+    }
+    if (elements.empty()) {
+      continue;
+    }
+
+    output_file_names.push_back(output_file_prefix + std::to_string(i) +
+                                ".h5");
+    if (file_system::check_if_file_exists(output_file_names.back())) {
+      file_system::rm(output_file_names.back(), false);
+    }
+    H5File<AccessType::ReadWrite> output_file(output_file_names.back());
+    output_file.insert<VolumeData>(subfile_name, version)
+        .write_volume_data(observation_id, observation_value, elements);
+  }
+  return output_file_names;
+}
+}  // namespace h5
+/// \endcond
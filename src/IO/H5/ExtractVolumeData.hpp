@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Merge the `h5::VolumeData` subfiles `subfile_name` of all the
+ * `h5_file_names` into one H5 file per observation, keeping only part of the
+ * data.
+ *
+ * \details The observations of all files with an observation value in
+ * `[start_value, stop_value]` are ordered by their observation values, and
+ * the `i`th of them is written to the file `OUTPUT_FILE_PREFIXi.h5`, where
+ * `OUTPUT_FILE_PREFIX` is `output_file_prefix`. Each output file has a single
+ * `h5::VolumeData` subfile `subfile_name` holding the grids of all input files
+ * at that observation. Existing output files are overwritten.
+ *
+ * Only the `tensor_components` (all of them if empty) of the grids whose names
+ * contain `grid_name_filter` are written, and only the data of these grids is
+ * read from the input files. Remember to keep the coordinates if the output is
+ * to be visualized.
+ *
+ * The observations are split into `number_of_parts` parts, of which only part
+ * `part` is written, so that several processes can merge the data in
+ * parallel, e.g. process `p` of `P` writes part `p` of `P` parts.
+ *
+ * \returns the names of the written files
+ */
+std::vector<std::string> extract_volume_data(
+    const std::vector<std::string>& h5_file_names,
+    const std::string& subfile_name, const std::string& output_file_prefix,
+    const std::vector<std::string>& tensor_components,
+    const std::string& grid_name_filter, double start_value,
+    double stop_value, size_t number_of_parts = 1, size_t part = 0) noexcept;
+}  // namespace h5
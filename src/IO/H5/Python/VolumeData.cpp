@@ -1,9 +1,11 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <cstddef>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -26,8 +28,19 @@ void bind_h5vol(py::module& m) {  // NOLINT
            py::arg("observation_id"))
       .def("list_tensor_components", &h5::VolumeData::list_tensor_components,
            py::arg("observation_id"))
-      .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
+      // The returned DataVector supports the buffer protocol, so
+      // `numpy.asarray` views its data without copying
+      .def("get_tensor_component",
+           static_cast<DataVector (h5::VolumeData::*)(size_t,
+                                                      const std::string&)
+                           const>(&h5::VolumeData::get_tensor_component),
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def("get_tensor_component",
+           static_cast<DataVector (h5::VolumeData::*)(
+               size_t, const std::string&, const std::vector<std::string>&)
+                           const>(&h5::VolumeData::get_tensor_component),
+           py::arg("observation_id"), py::arg("tensor_component"),
+           py::arg("grid_names"))
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"));
   m.def("offset_and_length_for_grid", &h5::offset_and_length_for_grid,
@@ -4,12 +4,16 @@
 #include "IO/H5/VolumeData.hpp"
 
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <hdf5.h>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -17,9 +21,12 @@
 #include "ErrorHandling/Error.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
+#include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/Numeric.hpp"
@@ -45,13 +52,23 @@ void append_element_extents_and_connectivity(
   // Find the number of points in the local connectivity
   const int element_num_points =
       alg::accumulate(extents, 1, std::multiplies<>{});
-  // Generate the connectivity data for the element
+  // Generate the connectivity data for the element, leaving out the
+  // dimensions with a single point, which have no cells.
   // Possible optimization: local_connectivity.reserve(BLAH) if we can figure
   // out size without computing all the connectivities.
   const std::vector<int> connectivity =
       [&extents, &total_points_so_far ]() noexcept {
     std::vector<int> local_connectivity;
-    for (const auto& cell : vis::detail::compute_cells(extents)) {
+    std::vector<size_t> extents_with_cells{};
+    for (const size_t extent : extents) {
+      if (extent > 1) {
+        extents_with_cells.push_back(extent);
+      }
+    }
+    if (extents_with_cells.empty()) {
+      return local_connectivity;
+    }
+    for (const auto& cell : vis::detail::compute_cells(extents_with_cells)) {
       for (const auto& bounding_indices : cell.bounding_indices) {
         local_connectivity.emplace_back(*total_points_so_far +
                                         static_cast<int>(bounding_indices));
@@ -290,6 +307,114 @@ DataVector VolumeData::get_tensor_component(
   }
 }
 
+DataVector VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::string>& grid_names) const noexcept {
+  const std::vector<std::string> all_grid_names =
+      get_grid_names(observation_id);
+  const std::vector<std::vector<size_t>> all_extents =
+      get_extents(observation_id);
+  std::unordered_map<std::string, std::pair<size_t, size_t>>
+      all_offsets_and_lengths{};
+  size_t offset = 0;
+  for (size_t i = 0; i < all_grid_names.size(); ++i) {
+    const size_t length =
+        alg::accumulate(all_extents[i], 1_st, std::multiplies<>{});
+    all_offsets_and_lengths.emplace(all_grid_names[i],
+                                    std::make_pair(offset, length));
+    offset += length;
+  }
+  std::vector<std::pair<size_t, size_t>> offsets_and_lengths{};
+  offsets_and_lengths.reserve(grid_names.size());
+  for (const auto& grid_name : grid_names) {
+    const auto found = all_offsets_and_lengths.find(grid_name);
+    if (found == all_offsets_and_lengths.end()) {
+      ERROR("Found no grid named '" + grid_name + "'.");
+    }
+    offsets_and_lengths.push_back(found->second);
+  }
+  return get_tensor_component(observation_id, tensor_component,
+                              offsets_and_lengths);
+}
+
+DataVector VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const
+    noexcept {
+  // The offset into the dataset, the length, and the offset into the result
+  // of the data of each requested grid
+  std::vector<std::array<size_t, 3>> blocks{};
+  blocks.reserve(offsets_and_lengths.size());
+  size_t total_length = 0;
+  for (const auto& offset_and_length : offsets_and_lengths) {
+    blocks.push_back(
+        {{offset_and_length.first, offset_and_length.second, total_length}});
+    total_length += offset_and_length.second;
+  }
+  DataVector result(total_length);
+  if (total_length == 0) {
+    return result;
+  }
+
+  // HDF5 reads a union of hyperslabs in the order of the dataset, so when the
+  // grids are requested in a different order the data is read into a buffer
+  // and reordered afterward.
+  auto sorted_blocks = blocks;
+  alg::sort(sorted_blocks);
+  for (size_t i = 1; i < sorted_blocks.size(); ++i) {
+    if (sorted_blocks[i][0] == sorted_blocks[i - 1][0]) {
+      ERROR("The grid at offset " << sorted_blocks[i][0]
+                                  << " was requested more than once.");
+    }
+  }
+  const bool in_dataset_order = sorted_blocks == blocks;
+
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const auto rank =
+      static_cast<size_t>(H5Sget_simple_extent_ndims(dataspace_id));
+  if (rank != 1) {
+    ERROR("Reading a subset of the grids requires data of rank 1, but '"
+          << tensor_component << "' has rank " << rank);
+  }
+  CHECK_H5(H5Sselect_none(dataspace_id), "Failed to reset the selection");
+  for (const auto& block : sorted_blocks) {
+    const hsize_t start = block[0];
+    const hsize_t count = block[1];
+    CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, &start, nullptr,
+                                 &count, nullptr),
+             "Failed to select the data of a grid");
+  }
+  const hsize_t memory_size = total_length;
+  const hid_t memspace_id = H5Screate_simple(1, &memory_size, nullptr);
+  CHECK_H5(memspace_id, "Failed to create memory space");
+  DataVector buffer =
+      in_dataset_order ? DataVector{} : DataVector(total_length);
+  CHECK_H5(H5Dread(dataset_id, h5_type<double>(), memspace_id, dataspace_id,
+                   h5::h5p_default(),
+                   in_dataset_order ? result.data() : buffer.data()),
+           "Failed to read the data of the grids of '" << tensor_component
+                                                       << "'");
+  CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+
+  if (not in_dataset_order) {
+    size_t buffer_offset = 0;
+    for (const auto& block : sorted_blocks) {
+      std::copy(buffer.data() + buffer_offset,
+                buffer.data() + buffer_offset + block[1],
+                result.data() + block[2]);
+      buffer_offset += block[1];
+    }
+  }
+  return result;
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const noexcept {
   const std::string path = "ObservationId" + std::to_string(observation_id);
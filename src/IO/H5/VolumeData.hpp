@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ErrorHandling/Error.hpp"
@@ -59,6 +60,10 @@ namespace h5 {
  * `h5::offset_and_length_for_grid` function to compute the offset into the
  * contiguous dataset that corresponds to a particular grid.
  *
+ * The connectivity of each grid leaves out the dimensions in which the grid
+ * has a single point, so e.g. a slice of a 3D element with extents
+ * `{4, 1, 4}` is connected as quadrilaterals.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -131,6 +136,25 @@ class VolumeData : public h5::Object {
                                   const std::string& tensor_component) const
       noexcept;
 
+  /// Read a tensor component with name `tensor_component` at observation id
+  /// `observation_id` from only the grids `grid_names`, concatenated in the
+  /// order of `grid_names`. Only the data of these grids is read from the
+  /// file, so this is much cheaper than reading all grids when `grid_names`
+  /// is a small subset of them.
+  DataVector get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::string>& grid_names) const noexcept;
+
+  /// Read a tensor component with name `tensor_component` at observation id
+  /// `observation_id` from only the grids at the `offsets_and_lengths` into
+  /// the dataset (see `h5::offset_and_length_for_grid`), concatenated in the
+  /// order of `offsets_and_lengths`. Use this overload to read several tensor
+  /// components of the same grids without looking up the grids every time.
+  DataVector get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const
+      noexcept;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const
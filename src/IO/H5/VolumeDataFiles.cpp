@@ -0,0 +1,48 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/VolumeDataFiles.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/Algorithm.hpp"
+
+namespace h5 {
+VolumeDataFiles::VolumeDataFiles(const std::vector<std::string>& h5_file_names,
+                                 const std::string& subfile_name) noexcept {
+  for (const auto& h5_file_name : h5_file_names) {
+    h5_files_.push_back(
+        std::make_unique<H5File<AccessType::ReadOnly>>(h5_file_name));
+    volume_files_.push_back(&h5_files_.back()->get<VolumeData>(subfile_name));
+    const auto ids = volume_files_.back()->list_observation_ids();
+    observation_ids_.emplace_back(ids.begin(), ids.end());
+    for (const size_t observation_id : ids) {
+      if (observation_values_.count(observation_id) == 0) {
+        observation_values_.emplace(
+            observation_id,
+            volume_files_.back()->get_observation_value(observation_id));
+      }
+    }
+  }
+}
+
+std::vector<std::pair<double, size_t>> VolumeDataFiles::observations(
+    const double start_value, const double stop_value) const noexcept {
+  std::vector<std::pair<double, size_t>> values_and_ids{};
+  for (const auto& id_and_value : observation_values_) {
+    if (id_and_value.second >= start_value and
+        id_and_value.second <= stop_value) {
+      values_and_ids.emplace_back(id_and_value.second, id_and_value.first);
+    }
+  }
+  alg::sort(values_and_ids);
+  return values_and_ids;
+}
+}  // namespace h5
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+
+/// \cond
+namespace h5 {
+class VolumeData;
+}  // namespace h5
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief The `h5::VolumeData` subfiles `subfile_name` of several H5 files,
+ * e.g. the files written by the nodes of a simulation, and the observations
+ * they hold.
+ *
+ * \details The files are opened read-only and stay open for the lifetime of
+ * this object. The observation ids and values of all files are read once on
+ * construction.
+ */
+class VolumeDataFiles {
+ public:
+  VolumeDataFiles(const std::vector<std::string>& h5_file_names,
+                  const std::string& subfile_name) noexcept;
+
+  /// The number of files
+  size_t size() const noexcept { return volume_files_.size(); }
+
+  /// The volume subfile of the `file_index`th file
+  const VolumeData& volume_file(const size_t file_index) const noexcept {
+    return *volume_files_[file_index];
+  }
+
+  /// Whether the `file_index`th file holds data at the `observation_id`
+  bool has_observation(const size_t file_index,
+                       const size_t observation_id) const noexcept {
+    return observation_ids_[file_index].count(observation_id) == 1;
+  }
+
+  /// The observation values and ids of all files with an observation value in
+  /// `[start_value, stop_value]`, ordered by the observation value
+  std::vector<std::pair<double, size_t>> observations(
+      double start_value, double stop_value) const noexcept;
+
+ private:
+  std::vector<std::unique_ptr<H5File<AccessType::ReadOnly>>> h5_files_{};
+  std::vector<const VolumeData*> volume_files_{};
+  std::vector<std::unordered_set<size_t>> observation_ids_{};
+  std::unordered_map<size_t, double> observation_values_{};
+};
+}  // namespace h5
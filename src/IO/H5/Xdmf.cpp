@@ -0,0 +1,253 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/Xdmf.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <ios>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ErrorHandling/Error.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataFiles.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Numeric.hpp"
+
+/// \cond HIDDEN_SYMBOLS
+namespace h5 {
+namespace {
+const std::string xdmf_header =
+    "<?xml version=\"1.0\" ?>\n"
+    "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\">\n"
+    "<Xdmf Version=\"2.0\">\n"
+    "<Domain>\n"
+    "<Grid Name=\"Evolution\" GridType=\"Collection\" "
+    "CollectionType=\"Temporal\">\n";
+const std::string xdmf_footer = "</Grid>\n</Domain>\n</Xdmf>\n";
+
+bool ends_with(const std::string& name, const std::string& suffix) noexcept {
+  return name.size() >= suffix.size() and
+         name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// The path of the subfile in the H5 file, as written by h5::VolumeData
+std::string volume_data_path(const std::string& subfile_name) noexcept {
+  std::string path =
+      subfile_name.front() == '/' ? subfile_name : '/' + subfile_name;
+  if (not ends_with(path, VolumeData::extension())) {
+    path += VolumeData::extension();
+  }
+  return path;
+}
+
+// The number of dimensions in which a grid has more than one point
+size_t number_of_dimensions_with_cells(
+    const std::vector<size_t>& grid_extents) noexcept {
+  return static_cast<size_t>(alg::count_if(
+      grid_extents, [](const size_t extent) noexcept { return extent > 1; }));
+}
+
+std::string time_grid(const double observation_value,
+                      const std::string& grids) noexcept {
+  std::ostringstream time_grid{};
+  time_grid << "  <Grid Name=\"Grids\" GridType=\"Collection\">\n"
+            << "    <Time Value=\"" << std::scientific << std::setprecision(14)
+            << observation_value << "\"/>\n"
+            << grids << "  </Grid>\n";
+  return time_grid.str();
+}
+}  // namespace
+
+std::string xdmf_grid(const std::string& h5_file_name,
+                      const std::string& subfile_name,
+                      const size_t observation_id,
+                      const std::vector<std::vector<size_t>>& extents,
+                      const std::vector<std::string>& tensor_components,
+                      const std::string& coordinates) noexcept {
+  if (extents.empty()) {
+    ERROR("Cannot describe an observation without any grids.");
+  }
+  const size_t dim = extents.front().size();
+  if (dim != 2 and dim != 3) {
+    ERROR("Only 2D and 3D data can be described by XDMF, not " << dim
+                                                               << "D data.");
+  }
+  // The dimensions in which the grids have a single point are left out of
+  // the topology, as they are in the connectivity written by h5::VolumeData,
+  // so e.g. slices of 3D data are described by quadrilaterals.
+  const size_t topological_dim =
+      number_of_dimensions_with_cells(extents.front());
+  if (topological_dim == 0) {
+    ERROR("Cannot describe grids with a single point in '" << h5_file_name
+                                                          << "'.");
+  }
+  for (const auto& grid_extents : extents) {
+    if (number_of_dimensions_with_cells(grid_extents) != topological_dim) {
+      ERROR("All grids in '" << h5_file_name
+                             << "' must have more than one point in the same "
+                                "number of dimensions.");
+    }
+  }
+  const std::vector<std::string> directions =
+      dim == 3 ? std::vector<std::string>{"_x", "_y", "_z"}
+               : std::vector<std::string>{"_x", "_y"};
+  std::vector<std::string> coordinate_components{};
+  for (const auto& direction : directions) {
+    coordinate_components.push_back(coordinates + direction);
+    if (not alg::found(tensor_components, coordinate_components.back())) {
+      ERROR("No '" << coordinate_components.back() << "' component found in '"
+                   << h5_file_name << "'.");
+    }
+  }
+
+  // Tensor products of lines, with one cell less than the points in each
+  // direction that has more than one point
+  size_t number_of_points = 0;
+  size_t number_of_cells = 0;
+  for (const auto& grid_extents : extents) {
+    number_of_points +=
+        alg::accumulate(grid_extents, size_t{1}, std::multiplies<>{});
+    number_of_cells += alg::accumulate(
+        grid_extents, size_t{1}, [](const size_t cells, const size_t points) {
+          return points > 1 ? cells * (points - 1) : cells;
+        });
+  }
+
+  const std::string grid_path = "          " + h5_file_name + ":" +
+                                volume_data_path(subfile_name) +
+                                "/ObservationId" +
+                                std::to_string(observation_id) + "/";
+  const std::string data_item =
+      "        <DataItem Dimensions=\" " + std::to_string(number_of_points) +
+      "\" NumberType=\"Double\" Precision=\"8\" Format=\"HDF5\">\n";
+  const auto write_data_item = [&data_item, &grid_path](
+                                   std::ostringstream& os,
+                                   const std::string& component) noexcept {
+    os << data_item << grid_path << component << "\n        </DataItem>\n";
+  };
+
+  std::ostringstream grid{};
+  grid << "    <Grid Name=\"" << h5_file_name << "\" GridType=\"Uniform\">\n";
+  // Hexahedra in 3D, quadrilaterals in 2D and lines in 1D
+  const size_t points_per_cell = size_t{1} << topological_dim;
+  std::string topology_type = "Polyline\" NodesPerElement=\"2";
+  if (topological_dim == 3) {
+    topology_type = "Hexahedron";
+  } else if (topological_dim == 2) {
+    topology_type = "Quadrilateral";
+  }
+  grid << "      <Topology TopologyType=\"" << topology_type
+       << "\" NumberOfElements=\"" << number_of_cells << "\">\n"
+       << "        <DataItem Dimensions=\"" << number_of_cells << " "
+       << points_per_cell << "\" NumberType=\"Int\" Format=\"HDF5\">\n"
+       << grid_path << "connectivity\n        </DataItem>\n      </Topology>\n";
+
+  grid << "      <Geometry Type=\"" << (dim == 3 ? "X_Y_Z" : "X_Y") << "\">\n";
+  for (const auto& coordinate_component : coordinate_components) {
+    write_data_item(grid, coordinate_component);
+  }
+  grid << "      </Geometry>\n";
+
+  for (const auto& component : tensor_components) {
+    if (alg::found(coordinate_components, component)) {
+      continue;
+    }
+    if (ends_with(component, "_x")) {
+      // ParaView only supports 3D vectors, so in 2D the z-component is zero
+      const std::string vector = component.substr(0, component.size() - 2);
+      grid << "      <Attribute Name=\"" << vector
+           << "\" AttributeType=\"Vector\" Center=\"Node\">\n"
+           << "        <DataItem Dimensions=\" " << number_of_points
+           << " 3\" ItemType = \"Function\" Function = \""
+           << (dim == 3 ? "JOIN($0,$1,$2)" : "JOIN($0,$1, 0 * $1)")
+           << "\">\n";
+      for (const auto& direction : directions) {
+        write_data_item(grid, vector + direction);
+      }
+      grid << "        </DataItem>\n      </Attribute>\n";
+    } else if (not(ends_with(component, "_y") or ends_with(component, "_z"))) {
+      // The y- and z-components of vectors are written with the x-component
+      grid << "      <Attribute Name=\"" << component
+           << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+      write_data_item(grid, component);
+      grid << "      </Attribute>\n";
+    }
+  }
+  grid << "    </Grid>\n";
+  return grid.str();
+}
+
+void append_to_xdmf_file(const std::string& xdmf_file_name,
+                         const double observation_value,
+                         const std::string& grids) noexcept {
+  std::fstream xdmf_file(xdmf_file_name, std::ios::in | std::ios::out);
+  if (not xdmf_file.is_open()) {
+    xdmf_file.open(xdmf_file_name, std::ios::out);
+    if (not xdmf_file.is_open()) {
+      ERROR("Unable to open the XDMF file '" << xdmf_file_name << "'.");
+    }
+    xdmf_file << xdmf_header;
+  } else {
+    // Overwrite the closing tags, which are rewritten after the new grids
+    const auto footer_size = static_cast<std::streamoff>(xdmf_footer.size());
+    std::string footer(xdmf_footer.size(), ' ');
+    xdmf_file.seekg(-footer_size, std::ios::end);
+    xdmf_file.read(&footer[0], footer_size);
+    if (not xdmf_file or footer != xdmf_footer) {
+      ERROR("The XDMF file '" << xdmf_file_name
+                              << "' does not end with a temporal collection.");
+    }
+    xdmf_file.seekp(-footer_size, std::ios::end);
+  }
+  xdmf_file << time_grid(observation_value, grids) << xdmf_footer;
+}
+
+void write_xdmf_file(const std::string& xdmf_file_name,
+                     const std::vector<std::string>& h5_file_names,
+                     const std::string& subfile_name,
+                     const std::string& coordinates, const double start_value,
+                     const double stop_value, const size_t stride) noexcept {
+  if (h5_file_names.empty()) {
+    ERROR("No H5 files to write the XDMF file '" << xdmf_file_name
+                                                 << "' for.");
+  }
+  const VolumeDataFiles volume_files(h5_file_names, subfile_name);
+  const auto values_and_ids =
+      volume_files.observations(start_value, stop_value);
+
+  if (file_system::check_if_file_exists(xdmf_file_name)) {
+    file_system::rm(xdmf_file_name, false);
+  }
+  std::ofstream xdmf_file(xdmf_file_name);
+  if (not xdmf_file.is_open()) {
+    ERROR("Unable to open the XDMF file '" << xdmf_file_name << "'.");
+  }
+  xdmf_file << xdmf_header;
+  for (size_t i = 0; i < values_and_ids.size(); i += stride) {
+    const size_t observation_id = values_and_ids[i].second;
+    std::string grids{};
+    for (size_t f = 0; f < volume_files.size(); ++f) {
+      // Files without data at this observation contribute no grid
+      if (not volume_files.has_observation(f, observation_id)) {
+        continue;
+      }
+      const auto& volume_file = volume_files.volume_file(f);
+      grids += xdmf_grid(h5_file_names[f], subfile_name, observation_id,
+                         volume_file.get_extents(observation_id),
+                         volume_file.list_tensor_components(observation_id),
+                         coordinates);
+    }
+    xdmf_file << time_grid(values_and_ids[i].first, grids);
+  }
+  xdmf_file << xdmf_footer;
+}
+}  // namespace h5
+/// \endcond
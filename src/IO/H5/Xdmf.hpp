@@ -0,0 +1,68 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief The XDMF description of the grids written at one observation of an
+ * `h5::VolumeData` subfile, so ParaView and VisIt can load the data.
+ *
+ * \details `h5_file_name` is the H5 file as it is referenced from the XDMF
+ * file, and `subfile_name` is the name of the `h5::VolumeData` subfile, e.g.
+ * `/element_data`. The grids are described by their `extents`, in the order
+ * they were written, and `tensor_components` are the names of the tensor
+ * components without the grid names. The components `COORDINATES_x`,
+ * `COORDINATES_y` (and `COORDINATES_z` in 3D) are the geometry of the grids,
+ * where `COORDINATES` is `coordinates`. The other components whose names end
+ * in `_x` are written as vectors and the remaining ones as scalars. The
+ * topology is the connectivity written by `h5::VolumeData`. It leaves out the
+ * dimensions in which the grids have a single point, so it consists of
+ * hexahedra, quadrilaterals or lines depending on the number of dimensions
+ * in which the grids have more than one point. For example, slices of 3D data
+ * with extents `{4, 1, 4}` are described by quadrilaterals.
+ *
+ * Only 2D and 3D data can be described, and all grids must have more than one
+ * point in the same number of dimensions.
+ */
+std::string xdmf_grid(const std::string& h5_file_name,
+                      const std::string& subfile_name, size_t observation_id,
+                      const std::vector<std::vector<size_t>>& extents,
+                      const std::vector<std::string>& tensor_components,
+                      const std::string& coordinates) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Append the `grids` (see `h5::xdmf_grid`) at time `observation_value`
+ * to the temporal collection in the XDMF file `xdmf_file_name`, creating the
+ * file if it does not exist.
+ *
+ * \details The file is a valid XDMF file after each call, so the data can be
+ * visualized while the simulation is running.
+ */
+void append_to_xdmf_file(const std::string& xdmf_file_name,
+                         double observation_value,
+                         const std::string& grids) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the XDMF file `xdmf_file_name` describing the `h5::VolumeData`
+ * subfile `subfile_name` of all the `h5_file_names`.
+ *
+ * \details The observations are those of all files, ordered by their
+ * observation values, so files holding different observations (e.g. those
+ * written by `h5::extract_volume_data`) can be combined. Only every
+ * `stride`th observation with an observation value in
+ * `[start_value, stop_value]` is included.
+ */
+void write_xdmf_file(const std::string& xdmf_file_name,
+                     const std::vector<std::string>& h5_file_names,
+                     const std::string& subfile_name,
+                     const std::string& coordinates, double start_value,
+                     double stop_value, size_t stride) noexcept;
+}  // namespace h5
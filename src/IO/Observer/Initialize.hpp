@@ -101,7 +101,8 @@ struct InitializeWriter {
                         Tags::VolumeObserversContributed,
                         Tags::ReductionObserversRegistered,
                         Tags::ReductionObserversRegisteredNodes,
-                        Tags::ReductionObserversContributed, Tags::H5FileLock>,
+                        Tags::ReductionObserversContributed, Tags::H5FileLock,
+                        Tags::BufferedReductionData>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
@@ -151,7 +152,9 @@ struct InitializeWriter {
             db::item_type<Tags::ReductionObserversRegistered>{},
             db::item_type<Tags::ReductionObserversRegisteredNodes>{},
             db::item_type<Tags::ReductionObserversContributed>{},
-            Parallel::create_lock(), db::item_type<ReductionTags>{}...,
+            Parallel::create_lock(),
+            db::item_type<Tags::BufferedReductionData>{},
+            db::item_type<ReductionTags>{}...,
             db::item_type<
                 detail::reduction_data_to_reduction_names<ReductionTags>>{}...),
         true);
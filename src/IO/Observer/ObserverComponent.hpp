@@ -7,8 +7,10 @@
 #include "AlgorithmNodegroup.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Utilities/TMPL.hpp"
@@ -48,17 +50,26 @@ template <class Metavariables>
 struct ObserverWriter {
   using chare_type = Parallel::Algorithms::Nodegroup;
   using const_global_cache_tags =
-      tmpl::list<Tags::ReductionFileName, Tags::VolumeFileName>;
+      tmpl::list<Tags::ReductionFileName, Tags::VolumeFileName,
+                 Tags::ReductionBufferSize>;
   using metavariables = Metavariables;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       typename metavariables::Phase, metavariables::Phase::Initialization,
       tmpl::list<Actions::InitializeWriter<Metavariables>>>>;
   using initialization_tags = Parallel::get_initialization_tags<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+  // The writer is also told about the `Exit` phase, so it can write buffered
+  // reduction data before the executable exits
+  static constexpr bool execute_exit_phase = true;
 
   static void execute_next_phase(
       const typename Metavariables::Phase /*next_phase*/,
-      Parallel::CProxy_ConstGlobalCache<
-          Metavariables>& /*global_cache*/) noexcept {}
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    // Write the buffered reduction data at the end of each phase, including
+    // the last one before the executable exits
+    Parallel::threaded_action<ThreadedActions::WriteBufferedReductionData>(
+        Parallel::get_parallel_component<ObserverWriter>(
+            *(global_cache.ckLocalBranch())));
+  }
 };
 }  // namespace observers
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <converse.h>
 #include <cstddef>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -24,6 +26,7 @@
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Printf.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Parallel/TypeTraits.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Requires.hpp"
@@ -41,6 +44,7 @@ struct ObserverWriter;
 namespace ThreadedActions {
 /// \cond
 struct WriteReductionData;
+struct WriteBufferedReductionData;
 /// \endcond
 }  // namespace ThreadedActions
 
@@ -160,6 +164,13 @@ namespace ThreadedActions {
  * ObserverWriter nodegroup before sending to node 0 for writing to disk.
  *
  * \note This action is also used for writing on node 0.
+ *
+ * On node 0 the reduced data is written to disk immediately, unless
+ * `observers::Tags::ReductionBufferSize` is nonzero. In that case the rows are
+ * collected in memory and appended to the reduction file once that many rows
+ * have been collected, and at the latest `maximum_buffer_time` seconds after
+ * the first of them was collected. The remaining rows are written by
+ * `WriteBufferedReductionData` at the start of every phase.
  */
 struct WriteReductionData {
  private:
@@ -176,25 +187,52 @@ struct WriteReductionData {
   }
 
   template <typename... Ts, size_t... Is>
-  static void write_data(const std::string& subfile_name,
-                         std::vector<std::string>&& legend,
-                         std::tuple<Ts...>&& data,
-                         const std::string& file_prefix,
-                         std::index_sequence<Is...> /*meta*/) noexcept {
+  static std::vector<double> make_row(
+      const std::tuple<Ts...>& data,
+      std::index_sequence<Is...> /*meta*/) noexcept {
     static_assert(sizeof...(Ts) > 0,
                   "Must be reducing at least one piece of data");
-    std::vector<double> data_to_append{};
+    std::vector<double> row{};
     EXPAND_PACK_LEFT_TO_RIGHT(
-        append_to_reduction_data(&data_to_append, std::get<Is>(data)));
+        append_to_reduction_data(&row, std::get<Is>(data)));
+    return row;
+  }
+
+  // Called by Charm++ `maximum_buffer_time` seconds after rows were first
+  // collected in memory, so they are written even if no more rows arrive.
+  template <typename Metavariables>
+  static void write_buffered_data_after_timeout(
+      void* const cache, const double /*current_wall_time*/) noexcept {
+    Parallel::threaded_action<WriteBufferedReductionData>(
+        Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+            *static_cast<Parallel::ConstGlobalCache<Metavariables>*>(
+                cache))[0]);
+  }
+
+ public:
+  /// The wall time (in seconds) after which rows collected in memory are
+  /// written to disk, even if fewer than `observers::Tags::ReductionBufferSize`
+  /// rows have been collected.
+  static constexpr double maximum_buffer_time = 60.0;
 
+  /// Append the `buffered_data` (see `Tags::BufferedReductionData`) to the
+  /// reduction file, opening the file only once.
+  static void write_buffered_data(
+      db::item_type<Tags::BufferedReductionData>&& buffered_data,
+      const std::string& file_prefix) noexcept {
+    if (buffered_data.empty()) {
+      return;
+    }
     h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true);
     constexpr size_t version_number = 0;
-    auto& time_series_file = h5file.try_insert<h5::Dat>(
-        subfile_name, std::move(legend), version_number);
-    time_series_file.append(data_to_append);
+    for (auto& subfile_name_and_rows : buffered_data) {
+      auto& time_series_file = h5file.try_insert<h5::Dat>(
+          subfile_name_and_rows.first,
+          std::move(subfile_name_and_rows.second.first), version_number);
+      time_series_file.append(subfile_name_and_rows.second.second);
+    }
   }
 
- public:
   template <
       typename ParallelComponent, typename DbTagsList, typename Metavariables,
       typename ArrayIndex, typename... ReductionDatums,
@@ -204,7 +242,9 @@ struct WriteReductionData {
                    DbTagsList, Tags::ReductionDataNames<ReductionDatums...>> and
                tmpl::list_contains_v<DbTagsList,
                                      Tags::ReductionObserversContributed> and
-               tmpl::list_contains_v<DbTagsList, Tags::H5FileLock>> = nullptr>
+               tmpl::list_contains_v<DbTagsList, Tags::H5FileLock> and
+               tmpl::list_contains_v<DbTagsList,
+                                     Tags::BufferedReductionData>> = nullptr>
   static void apply(db::DataBox<DbTagsList>& box,
                     Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
@@ -321,15 +361,108 @@ struct WriteReductionData {
             reduction_data->erase(observation_id);
           }
         });
-    Parallel::unlock(node_lock);
 
+    // The reduced data can be collected in memory and written in blocks, so
+    // the file is not reopened and the datasets are not extended for every
+    // row.
+    db::item_type<Tags::BufferedReductionData> data_to_write{};
     if (write_to_disk) {
-      Parallel::lock(&file_lock);
       in_reduction_data.finalize();
-      WriteReductionData::write_data(
-          subfile_name, std::move(legend), std::move(in_reduction_data.data()),
-          Parallel::get<Tags::ReductionFileName>(cache),
-          std::make_index_sequence<sizeof...(ReductionDatums)>{});
+      const size_t buffer_size =
+          Parallel::get<Tags::ReductionBufferSize>(cache);
+      db::mutate<Tags::BufferedReductionData>(
+          make_not_null(&box),
+          [&buffer_size, &cache, &data_to_write, &in_reduction_data, &legend,
+           &subfile_name](
+              const gsl::not_null<db::item_type<Tags::BufferedReductionData>*>
+                  buffered_data) noexcept {
+            if (buffered_data->empty() and buffer_size > 1) {
+              // The timer is only set for the Charm++ nodegroup, e.g. not for
+              // the mock components the action testing framework provides
+              using writer_proxy = std::decay_t<
+                  decltype(Parallel::get_parallel_component<
+                           ObserverWriter<Metavariables>>(cache))>;
+              if constexpr (Parallel::is_node_group_proxy<
+                                writer_proxy>::value) {
+                CcdCallFnAfter(
+                    &write_buffered_data_after_timeout<Metavariables>,
+                    static_cast<void*>(&cache), 1000.0 * maximum_buffer_time);
+              }
+            }
+            auto& legend_and_rows = (*buffered_data)[subfile_name];
+            if (legend_and_rows.first.empty()) {
+              legend_and_rows.first = std::move(legend);
+            }
+            legend_and_rows.second.push_back(make_row(
+                in_reduction_data.data(),
+                std::make_index_sequence<sizeof...(ReductionDatums)>{}));
+            size_t number_of_buffered_rows = 0;
+            for (const auto& subfile_and_rows : *buffered_data) {
+              number_of_buffered_rows += subfile_and_rows.second.second.size();
+            }
+            if (number_of_buffered_rows >= buffer_size) {
+              data_to_write = std::move(*buffered_data);
+              buffered_data->clear();
+            }
+          });
+    }
+    Parallel::unlock(node_lock);
+
+    if (not data_to_write.empty()) {
+      Parallel::lock(&file_lock);
+      write_buffered_data(std::move(data_to_write),
+                          Parallel::get<Tags::ReductionFileName>(cache));
+      Parallel::unlock(&file_lock);
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Write the reduction data that `WriteReductionData` has collected in
+ * memory to disk.
+ *
+ * \details This is invoked on the `ObserverWriter` at the start of every phase,
+ * including the `Exit` phase, so all reduction data is on disk when a phase
+ * ends and when the executable exits normally. It is also invoked
+ * `WriteReductionData::maximum_buffer_time` seconds after rows are first
+ * collected in memory.
+ *
+ * \warning Reduction data that is still in memory when the executable aborts
+ * is not written. Runs that may abort should set
+ * `observers::Tags::ReductionBufferSize` to zero, which is the default.
+ */
+struct WriteBufferedReductionData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            Requires<tmpl::list_contains_v<DbTagsList,
+                                           Tags::BufferedReductionData>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    CmiNodeLock file_lock;
+    db::item_type<Tags::BufferedReductionData> data_to_write{};
+    Parallel::lock(node_lock);
+    db::mutate<Tags::BufferedReductionData, Tags::H5FileLock>(
+        make_not_null(&box),
+        [&data_to_write, &file_lock ](
+            const gsl::not_null<db::item_type<Tags::BufferedReductionData>*>
+                buffered_data,
+            const gsl::not_null<CmiNodeLock*> reduction_file_lock) noexcept {
+          data_to_write = std::move(*buffered_data);
+          buffered_data->clear();
+          file_lock = *reduction_file_lock;
+        });
+    Parallel::unlock(node_lock);
+
+    if (not data_to_write.empty()) {
+      Parallel::lock(&file_lock);
+      WriteReductionData::write_buffered_data(
+          std::move(data_to_write),
+          Parallel::get<Tags::ReductionFileName>(cache));
       Parallel::unlock(&file_lock);
     }
   }
@@ -11,6 +11,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
@@ -120,6 +121,15 @@ struct ReductionObserversContributed : db::SimpleTag {
 struct H5FileLock : db::SimpleTag {
   using type = CmiNodeLock;
 };
+
+/// Reduced data that has not been written to disk yet, by the name of the
+/// `h5::Dat` subfile it is written to. Each entry holds the legend of the
+/// subfile and the rows to append to it.
+struct BufferedReductionData : db::SimpleTag {
+  using type = std::unordered_map<
+      std::string, std::pair<std::vector<std::string>,
+                             std::vector<std::vector<double>>>>;
+};
 }  // namespace Tags
 
 /// \ingroup ObserversGroup
@@ -149,6 +159,19 @@ struct ReductionFileName {
       "Name of the reduction data file without extension"};
   using group = Group;
 };
+
+/// \ingroup ObserversGroup
+/// The number of rows of reduction data that are collected in memory before
+/// they are written to disk.
+struct ReductionBufferSize {
+  using type = size_t;
+  static constexpr OptionString help = {
+      "Number of rows of reduction data to collect in memory before writing "
+      "them to disk. Rows in memory are lost if the executable aborts, so the "
+      "default of zero writes every row immediately."};
+  static type default_value() noexcept { return 0; }
+  using group = Group;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -173,5 +196,18 @@ struct ReductionFileName : db::SimpleTag {
     return reduction_file_name;
   }
 };
+
+/// The number of rows of reduction data that are collected in memory before
+/// they are written to disk, zero meaning that every row is written
+/// immediately.
+struct ReductionBufferSize : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<::observers::OptionTags::ReductionBufferSize>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t buffer_size) noexcept {
+    return buffer_size;
+  }
+};
 }  // namespace Tags
 }  // namespace observers
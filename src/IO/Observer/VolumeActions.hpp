@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -14,6 +17,7 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/Xdmf.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -23,6 +27,7 @@
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/FileSystem.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -190,6 +195,11 @@ namespace ThreadedActions {
 /*!
  * \ingroup ObserversGroup
  * \brief Writes volume data at the `observation_id` to disk.
+ *
+ * \details If the data are 2D or 3D and include the `InertialCoordinates`,
+ * the observation is also appended to an XDMF file next to the H5 file (see
+ * `h5::append_to_xdmf_file`), so the data can be visualized without
+ * post-processing.
  */
 struct WriteVolumeData {
   template <
@@ -220,6 +230,19 @@ struct WriteVolumeData {
         });
     Parallel::unlock(node_lock);
 
+    // Elements that have nothing to observe at this time, e.g. because they
+    // don't intersect an observed slice, contribute no tensor components.
+    std::vector<ExtentsAndTensorVolumeData> dg_elements;
+    dg_elements.reserve(volume_data.size());
+    for (auto& id_and_element : volume_data) {
+      if (not id_and_element.second.tensor_components.empty()) {
+        dg_elements.push_back(std::move(id_and_element.second));
+      }
+    }
+    if (dg_elements.empty()) {
+      return;
+    }
+
     // Write to file. We use a separate node lock because writing can be very
     // time consuming (it's network dependent, depends on how full the disks
     // are, what other users are doing, etc.) and we want to be able to continue
@@ -233,17 +256,60 @@ struct WriteVolumeData {
       constexpr size_t version_number = 0;
       auto& volume_file =
           h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-      std::vector<ExtentsAndTensorVolumeData> dg_elements;
-      dg_elements.reserve(volume_data.size());
-      for (const auto& id_and_element : volume_data) {
-        dg_elements.push_back(id_and_element.second);
-      }
       // Write the data to the file
       volume_file.write_volume_data(observation_id.hash(),
                                     observation_id.value(), dg_elements);
+      write_xdmf(file_prefix + std::to_string(Parallel::my_node()),
+                 subfile_name, observation_id, dg_elements);
     }
     Parallel::unlock(&file_lock);
   }
+
+ private:
+  static void write_xdmf(
+      const std::string& file_name, const std::string& subfile_name,
+      const observers::ObservationId& observation_id,
+      const std::vector<ExtentsAndTensorVolumeData>& dg_elements) noexcept {
+    const size_t dim = dg_elements.front().extents.size();
+    std::vector<std::string> tensor_components{};
+    for (const auto& component : dg_elements.front().tensor_components) {
+      tensor_components.push_back(
+          component.name.substr(component.name.find_last_of('/') + 1));
+    }
+    if ((dim != 2 and dim != 3) or
+        not alg::found(tensor_components,
+                       std::string{"InertialCoordinates_x"})) {
+      return;
+    }
+    // The grids must have more than one point in the same number of
+    // dimensions to be described by the same topology
+    const auto dimensions_with_cells =
+        [](const std::vector<size_t>& grid_extents) noexcept {
+          return alg::count_if(grid_extents, [](const size_t extent) noexcept {
+            return extent > 1;
+          });
+        };
+    std::vector<std::vector<size_t>> extents{};
+    extents.reserve(dg_elements.size());
+    for (const auto& element : dg_elements) {
+      if (dimensions_with_cells(element.extents) == 0 or
+          dimensions_with_cells(element.extents) !=
+              dimensions_with_cells(dg_elements.front().extents)) {
+        return;
+      }
+      extents.push_back(element.extents);
+    }
+    // Each subfile has its own XDMF file, e.g. `VolumeData0_slice_data.xmf`
+    // for the subfile `/slice_data`, in the same directory as the H5 file
+    std::string xdmf_subfile_name =
+        subfile_name.front() == '/' ? subfile_name.substr(1) : subfile_name;
+    std::replace(xdmf_subfile_name.begin(), xdmf_subfile_name.end(), '/', '_');
+    h5::append_to_xdmf_file(
+        file_name + "_" + xdmf_subfile_name + ".xmf", observation_id.value(),
+        h5::xdmf_grid(file_system::get_file_name(file_name + ".h5"),
+                      subfile_name, observation_id.hash(), extents,
+                      tensor_components, "InertialCoordinates"));
+  }
 };
 }  // namespace ThreadedActions
 }  // namespace observers
@@ -5,6 +5,7 @@
 
 #include <charm++.h>
 #include <charm.h>
+#include <string>
 
 #include "Informer/InfoFromBuild.hpp"
 #include "Parallel/Info.hpp"
@@ -22,6 +23,11 @@ void Informer::print_startup_info(CkArgMsg* msg) {
   Parallel::printf("%s\n", info_from_build());
 }
 
+void Informer::print_timing_info(const std::string& stage,
+                                 const double elapsed_wall_time) {
+  Parallel::printf("%s took %f seconds.\n", stage, elapsed_wall_time);
+}
+
 void Informer::print_exit_info() {
   Parallel::printf(
       "\n"
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <string>
+
 /// \cond
 class CkArgMsg;
 /// \endcond
@@ -17,6 +19,12 @@ class Informer {
   /// Print useful information at the beginning of a simulation.
   static void print_startup_info(CkArgMsg* msg);
 
+  /// Print the wall time `elapsed_wall_time` (in seconds) that `stage` of a
+  /// simulation took, e.g. the allocation of the array components or one of
+  /// the phases.
+  static void print_timing_info(const std::string& stage,
+                                double elapsed_wall_time);
+
   /// Print useful information at the end of a simulation.
   static void print_exit_info();
 };
@@ -14,6 +14,7 @@
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "Evolution/TypeTraits.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
@@ -49,12 +50,20 @@ namespace Actions {
 /// - DataBox:
 ///   - Tags::Time
 ///   - External<Tags::BoundaryCoordinates<volume_dim>>,
+///   - Tags::DirichletBoundaryDataCoordinates<volume_dim> (optional)
 ///
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
 /// - Modifies:
 ///      - External<typename system::variables_tag>
+///      - Tags::DirichletBoundaryDataCoordinates<volume_dim> (if present)
+///
+/// If the boundary condition is time-independent (see
+/// `evolution::is_time_independent_solution`) and the DataBox holds
+/// `Tags::DirichletBoundaryDataCoordinates`, the boundary data are only
+/// recomputed on faces whose coordinates have changed since they were last
+/// imposed.
 ///
 /// \see ReceiveDataForFluxes
 template <typename Metavariables>
@@ -96,6 +105,70 @@ struct ImposeDirichletBoundaryConditions {
   }
 
  private:
+  // Calls `impose_on_face(vars, boundary_condition, boundary_coords, time)`
+  // for each external boundary. If the boundary condition doesn't depend on
+  // time, faces whose coordinates haven't changed since the boundary data were
+  // last computed are skipped, so e.g. a stationary background on a static
+  // mesh is only evaluated once.
+  template <size_t VolumeDim, typename DbTags, typename ImposeOnFace>
+  static void impose_on_external_boundaries(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ImposeOnFace& impose_on_face) noexcept {
+    using system = typename Metavariables::system;
+    using exterior_vars_tag =
+        domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<
+                                    VolumeDim>,
+                                typename system::variables_tag>;
+    using boundary_coords_tag = domain::Tags::Interface<
+        domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
+        domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>;
+    using cached_coords_tag =
+        ::Tags::DirichletBoundaryDataCoordinates<VolumeDim>;
+
+    const double time = db::get<Tags::Time>(*box);
+    const auto& boundary_condition =
+        get<typename Metavariables::boundary_condition_tag>(cache);
+    const auto& boundary_coords = db::get<boundary_coords_tag>(*box);
+    if constexpr (evolution::is_time_independent_solution_v<
+                      typename Metavariables::boundary_condition_tag::type> and
+                  tmpl::list_contains_v<DbTags, cached_coords_tag>) {
+      db::mutate<exterior_vars_tag, cached_coords_tag>(
+          box,
+          [&boundary_condition, &boundary_coords, &impose_on_face, &time](
+              const gsl::not_null<db::item_type<exterior_vars_tag>*>
+                  external_bdry_vars,
+              const gsl::not_null<db::item_type<cached_coords_tag>*>
+                  cached_coords) noexcept {
+            for (auto& external_direction_and_vars : *external_bdry_vars) {
+              const auto& direction = external_direction_and_vars.first;
+              const auto& coords = boundary_coords.at(direction);
+              const auto cached_coords_on_face = cached_coords->find(direction);
+              if (cached_coords_on_face != cached_coords->end() and
+                  cached_coords_on_face->second == coords) {
+                continue;
+              }
+              impose_on_face(make_not_null(&external_direction_and_vars.second),
+                             boundary_condition, coords, time);
+              (*cached_coords)[direction] = coords;
+            }
+          });
+    } else {
+      db::mutate<exterior_vars_tag>(
+          box,
+          [&boundary_condition, &boundary_coords, &impose_on_face, &time](
+              const gsl::not_null<db::item_type<exterior_vars_tag>*>
+                  external_bdry_vars) noexcept {
+            for (auto& external_direction_and_vars : *external_bdry_vars) {
+              const auto& direction = external_direction_and_vars.first;
+              impose_on_face(make_not_null(&external_direction_and_vars.second),
+                             boundary_condition, boundary_coords.at(direction),
+                             time);
+            }
+          });
+    }
+  }
+
   template <size_t VolumeDim, typename DbTags>
   static std::tuple<db::DataBox<DbTags>&&> apply_impl(
       db::DataBox<DbTags>& box,
@@ -113,29 +186,14 @@ struct ImposeDirichletBoundaryConditions {
         "for conservative systems are implemented");
 
     // Apply the boundary condition
-    db::mutate_apply<tmpl::list<domain::Tags::Interface<
-                         domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-                         typename system::variables_tag>>,
-                     tmpl::list<>>(
-        [](const gsl::not_null<db::item_type<domain::Tags::Interface<
-               domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-               typename system::variables_tag>>*>
-               external_bdry_vars,
-           const double time, const auto& boundary_condition,
-           const auto& boundary_coords) noexcept {
-          for (auto& external_direction_and_vars : *external_bdry_vars) {
-            auto& direction = external_direction_and_vars.first;
-            auto& vars = external_direction_and_vars.second;
-            vars.assign_subset(boundary_condition.variables(
-                boundary_coords.at(direction), time,
-                typename system::variables_tag::type::tags_list{}));
-          }
-        },
-        make_not_null(&box), db::get<Tags::Time>(box),
-        get<typename Metavariables::boundary_condition_tag>(cache),
-        db::get<domain::Tags::Interface<
-            domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-            domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>>(box));
+    impose_on_external_boundaries<VolumeDim>(
+        make_not_null(&box), cache,
+        [](const auto vars, const auto& boundary_condition,
+           const auto& boundary_coords, const double time) noexcept {
+          vars->assign_subset(boundary_condition.variables(
+              boundary_coords, time,
+              typename system::variables_tag::type::tags_list{}));
+        });
 
     return std::forward_as_tuple(std::move(box));
   }
@@ -171,35 +229,19 @@ struct ImposeDirichletBoundaryConditions {
         "for conservative systems are implemented");
 
     // Apply the boundary condition
-    db::mutate_apply<tmpl::list<domain::Tags::Interface<
-                         domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-                         typename system::variables_tag>>,
-                     tmpl::list<>>(
-        [](const gsl::not_null<db::item_type<domain::Tags::Interface<
-               domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-               typename system::variables_tag>>*>
-               external_bdry_vars,
-           const double time, const auto& boundary_condition,
-           const auto& boundary_coords) noexcept {
-          for (auto& external_direction_and_vars : *external_bdry_vars) {
-            auto& direction = external_direction_and_vars.first;
-            auto& vars = external_direction_and_vars.second;
-
-            apply_impl_helper_conservative_from_primitive(
-                make_not_null(&vars),
-                boundary_condition.variables(
-                    boundary_coords.at(direction), time,
-                    typename system::conservative_from_primitive::
-                        argument_tags{}),
-                typename system::conservative_from_primitive::return_tags{},
-                tmpl::list<system>{});
-          }
-        },
-        make_not_null(&box), db::get<Tags::Time>(box),
-        get<typename Metavariables::boundary_condition_tag>(cache),
-        db::get<domain::Tags::Interface<
-            domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-            domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>>(box));
+    impose_on_external_boundaries<VolumeDim>(
+        make_not_null(&box), cache,
+        [](const auto vars, const auto& boundary_condition,
+           const auto& boundary_coords, const double time) noexcept {
+          apply_impl_helper_conservative_from_primitive(
+              vars,
+              boundary_condition.variables(
+                  boundary_coords, time,
+                  typename system::conservative_from_primitive::
+                      argument_tags{}),
+              typename system::conservative_from_primitive::return_tags{},
+              tmpl::list<system>{});
+        });
 
     return std::forward_as_tuple(std::move(box));
   }
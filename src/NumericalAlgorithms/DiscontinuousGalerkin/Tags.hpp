@@ -13,6 +13,8 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Structure/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/ElementId.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleMortarData.hpp"
@@ -52,6 +54,18 @@ template <size_t Dim>
 struct MortarSize : db::SimpleTag {
   using type = std::array<Spectral::MortarSize, Dim>;
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// The inertial coordinates on each external boundary at which the Dirichlet
+/// boundary data were last computed. Boundary conditions that don't depend on
+/// time are only recomputed on faces where these differ from the current
+/// boundary coordinates.
+template <size_t Dim>
+struct DirichletBoundaryDataCoordinates : db::SimpleTag {
+  using type = std::unordered_map<::Direction<Dim>,
+                                  tnsr::I<DataVector, Dim, Frame::Inertial>>;
+};
 }  // namespace Tags
 
 namespace OptionTags {
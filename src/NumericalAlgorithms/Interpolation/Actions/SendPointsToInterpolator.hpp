@@ -30,6 +30,8 @@ namespace Actions {
 ///   - `Tags::IndicesOfFilledInterpPoints`
 ///   - `Tags::IndicesOfInvalidInterpPoints`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>`
+///   - the tags modified by `InterpolationTargetTag::compute_target_points::
+///     prepare_points`, if it exists
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag>
@@ -43,6 +45,8 @@ struct SendPointsToInterpolator {
                     Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const TemporalId& temporal_id) noexcept {
+    InterpolationTarget_detail::prepare_points<InterpolationTargetTag>(
+        make_not_null(&box), temporal_id);
     auto coords = InterpolationTarget_detail::block_logical_coords<
         InterpolationTargetTag>(box, tmpl::type_<Metavariables>{}, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
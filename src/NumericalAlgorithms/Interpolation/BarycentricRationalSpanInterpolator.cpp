@@ -3,7 +3,7 @@
 
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 
-#include <boost/math/interpolators/barycentric_rational.hpp>
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 
@@ -20,6 +20,43 @@ BarycentricRationalSpanInterpolator::BarycentricRationalSpanInterpolator(
          "less than the maximum order.");
 }
 
+namespace {
+// Evaluates the Floater-Hormann barycentric rational interpolant of order
+// `order` (the same interpolant as `boost::math::barycentric_rational`). The
+// weight of each source point is computed as it is used, so no storage is
+// needed and each weight is shared by all components of a complex `ValueType`.
+template <typename ValueType>
+ValueType interpolate_impl(const gsl::span<const double>& source_points,
+                           const gsl::span<const ValueType>& values,
+                           const double target_point,
+                           const size_t order) noexcept {
+  const size_t number_of_points = source_points.size();
+  ValueType numerator{0.0};
+  double denominator = 0.0;
+  for (size_t k = 0; k < number_of_points; ++k) {
+    if (target_point == source_points[k]) {
+      return values[k];
+    }
+    double weight = 0.0;
+    const size_t i_min = k > order ? k - order : 0;
+    const size_t i_max = std::min(k, number_of_points - order - 1);
+    for (size_t i = i_min; i <= i_max; ++i) {
+      double product = 1.0;
+      for (size_t j = i; j <= i + order; ++j) {
+        if (j != k) {
+          product *= source_points[k] - source_points[j];
+        }
+      }
+      weight += (i % 2 == 0 ? 1.0 : -1.0) / product;
+    }
+    const double scaled_weight = weight / (target_point - source_points[k]);
+    numerator += scaled_weight * values[k];
+    denominator += scaled_weight;
+  }
+  return numerator / denominator;
+}
+}  // namespace
+
 double BarycentricRationalSpanInterpolator::interpolate(
     const gsl::span<const double>& source_points,
     const gsl::span<const double>& values, const double target_point) const
@@ -27,10 +64,19 @@ double BarycentricRationalSpanInterpolator::interpolate(
   if (UNLIKELY(source_points.size() < min_order_ + 1)) {
     ERROR("provided independent values for interpolation too small.");
   }
-  boost::math::barycentric_rational<double> interpolant(
-      source_points.data(), values.data(), source_points.size(),
-      std::min(source_points.size() - 1, max_order_));
-  return interpolant(target_point);
+  return interpolate_impl(source_points, values, target_point,
+                          std::min(source_points.size() - 1, max_order_));
+}
+
+std::complex<double> BarycentricRationalSpanInterpolator::interpolate(
+    const gsl::span<const double>& source_points,
+    const gsl::span<const std::complex<double>>& values,
+    const double target_point) const noexcept {
+  if (UNLIKELY(source_points.size() < min_order_ + 1)) {
+    ERROR("provided independent values for interpolation too small.");
+  }
+  return interpolate_impl(source_points, values, target_point,
+                          std::min(source_points.size() - 1, max_order_));
 }
 
 /// \cond
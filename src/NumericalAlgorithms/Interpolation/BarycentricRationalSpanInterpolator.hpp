@@ -68,13 +68,17 @@ class BarycentricRationalSpanInterpolator : public SpanInterpolator {
     return std::make_unique<BarycentricRationalSpanInterpolator>(*this);
   }
 
-  // to get the generic overload:
-  using SpanInterpolator::interpolate;
-
   double interpolate(const gsl::span<const double>& source_points,
                      const gsl::span<const double>& values,
                      double target_point) const noexcept override;
 
+  /// The barycentric weights depend only on the `source_points`, so they are
+  /// computed once and applied to the real and imaginary parts together.
+  std::complex<double> interpolate(
+      const gsl::span<const double>& source_points,
+      const gsl::span<const std::complex<double>>& values,
+      double target_point) const noexcept override;
+
   size_t required_number_of_points_before_and_after() const noexcept override {
     return min_order_ / 2 + 1;
   }
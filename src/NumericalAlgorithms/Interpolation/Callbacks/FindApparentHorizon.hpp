@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <deque>
 #include <utility>
 
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/Tags.hpp"
@@ -13,6 +15,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Informer/Verbosity.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
@@ -59,6 +62,11 @@ namespace callbacks {
 ///```
 /// that is called if the FastFlow iteration has converged.
 ///
+/// The first iteration of a find starts from the previously found horizons
+/// extrapolated to the new time, which
+/// `intrp::TargetPoints::ApparentHorizon::prepare_points` has put in the
+/// DataBox. The converged horizon is added to the previous horizons.
+///
 /// Uses:
 /// - Metavariables:
 ///   - `temporal_id`
@@ -69,11 +77,13 @@ namespace callbacks {
 ///   - `::gr::Tags::SpatialChristoffelSecondKind<3,Frame>`
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+///   - `::ah::Tags::PreviousStrahlkorpers<Frame>`
 ///
 /// Modifies:
 /// - DataBox:
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+///   - `::ah::Tags::PreviousStrahlkorpers<Frame>`
 ///
 /// This is an InterpolationTargetTag::post_interpolation_callback;
 /// see InterpolationTarget for a description of InterpolationTargetTag.
@@ -234,15 +244,26 @@ struct FindApparentHorizon {
                                                               temporal_id);
 
     // Prepare for finding horizon at a new time.
-    // For now, the initial guess for the new
-    // horizon is the result of the old one, so we don't need
-    // to modify the strahlkorper.
-    // Eventually we will hold more than one previous guess and
-    // will do time-extrapolation to set the next guess.
-    db::mutate<::ah::Tags::FastFlow>(
-        box, [](const gsl::not_null<::FastFlow*> fast_flow) noexcept {
+    // The initial guess for the new horizon is extrapolated in time from
+    // the most recent horizons, so keep this one.
+    db::mutate<::ah::Tags::FastFlow,
+               ::ah::Tags::PreviousStrahlkorpers<Frame::Inertial>>(
+        box, [&temporal_id](
+                 const gsl::not_null<::FastFlow*> fast_flow,
+                 const gsl::not_null<std::deque<
+                     std::pair<double, ::Strahlkorper<Frame::Inertial>>>*>
+                     previous_strahlkorpers,
+                 const ::Strahlkorper<Frame::Inertial>& strahlkorper) noexcept {
           fast_flow->reset_for_next_find();
-        });
+          previous_strahlkorpers->emplace_front(
+              InterpolationTarget_detail::get_temporal_id_value(temporal_id),
+              strahlkorper);
+          while (previous_strahlkorpers->size() >
+                 ::ah::number_of_previous_strahlkorpers) {
+            previous_strahlkorpers->pop_back();
+          }
+        },
+        db::get<StrahlkorperTags::Strahlkorper<Frame::Inertial>>(*box));
     // We return true because we are now done with all the volume data
     // at this temporal_id, so we want it cleaned up.
     return true;
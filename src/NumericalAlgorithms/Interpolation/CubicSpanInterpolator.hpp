@@ -53,7 +53,7 @@ class CubicSpanInterpolator : public SpanInterpolator {
   std::complex<double> interpolate(
       const gsl::span<const double>& source_points,
       const gsl::span<const std::complex<double>>& values,
-      double target_point) const noexcept;
+      double target_point) const noexcept override;
 
   size_t required_number_of_points_before_and_after() const noexcept override {
     return 2;
@@ -64,7 +64,15 @@ namespace intrp {
 ///      `InterpolationTarget` is initialized.  If `compute_target_points` has
 ///      an `initialize` function, it must also have a type alias
 ///      `initialization_tags` which is a `tmpl::list` of the tags that are
-///      added by `initialize`.
+///      added by `initialize`. For sequential targets,
+///      `compute_target_points` can (optionally) also have a function
+///```
+///   static void prepare_points(gsl::not_null<db::DataBox<DbTags>*>,
+///                              const Metavariables::temporal_id&) noexcept;
+///```
+///      that is called by `SendPointsToInterpolator` before the points are
+///      computed, so it can set up data that the points and the
+///      `post_interpolation_callback` share.
 /// - post_interpolation_callback:
 ///      A struct with a type alias `const_global_cache_tags` (listing tags that
 ///      should be read from option parsing), with a type alias
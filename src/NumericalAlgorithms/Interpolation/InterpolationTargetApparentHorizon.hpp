@@ -5,6 +5,7 @@
 
 #include <cstddef>
 
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/Tags.hpp"
@@ -12,9 +13,11 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Informer/Verbosity.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "NumericalAlgorithms/Interpolation/Tags.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -132,6 +135,12 @@ namespace TargetPoints {
 /// - It uses a `FastFlow` in the DataBox.
 /// - It has different options (including those for `FastFlow`).
 ///
+/// At the first iteration of a horizon find after a previous one,
+/// `prepare_points` replaces the Strahlkorper in the DataBox by the previous
+/// horizons extrapolated to the new time (see `ah::extrapolate_strahlkorper`),
+/// so the points and `intrp::callbacks::FindApparentHorizon` start the find
+/// from that surface.
+///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag, typename Frame>
 struct ApparentHorizon {
@@ -139,7 +148,8 @@ struct ApparentHorizon {
       tmpl::list<Tags::ApparentHorizon<InterpolationTargetTag, Frame>>;
   using initialization_tags =
       tmpl::append<StrahlkorperTags::items_tags<Frame>,
-                   tmpl::list<::ah::Tags::FastFlow, ::Tags::Verbosity>,
+                   tmpl::list<::ah::Tags::FastFlow, ::Tags::Verbosity,
+                              ::ah::Tags::PreviousStrahlkorpers<Frame>>,
                    StrahlkorperTags::compute_items_tags<Frame>>;
   using is_sequential = std::true_type;
   template <typename DbTags, typename Metavariables>
@@ -150,16 +160,37 @@ struct ApparentHorizon {
         Parallel::get<Tags::ApparentHorizon<InterpolationTargetTag, Frame>>(
             cache);
 
-    // Put Strahlkorper and its ComputeItems, FastFlow,
-    // and verbosity into a new DataBox.
+    // Put Strahlkorper and its ComputeItems, FastFlow, verbosity,
+    // and the (so far empty) previous horizons into a new DataBox.
     return db::create_from<
         db::RemoveTags<>,
-        db::AddSimpleTags<
-            tmpl::push_back<StrahlkorperTags::items_tags<Frame>,
-                            ::ah::Tags::FastFlow, ::Tags::Verbosity>>,
+        db::AddSimpleTags<tmpl::push_back<
+            StrahlkorperTags::items_tags<Frame>, ::ah::Tags::FastFlow,
+            ::Tags::Verbosity, ::ah::Tags::PreviousStrahlkorpers<Frame>>>,
         db::AddComputeTags<StrahlkorperTags::compute_items_tags<Frame>>>(
         std::move(box), options.initial_guess, options.fast_flow,
-        options.verbosity);
+        options.verbosity,
+        db::item_type<::ah::Tags::PreviousStrahlkorpers<Frame>>{});
+  }
+
+  template <typename DbTags, typename TemporalId>
+  static void prepare_points(const gsl::not_null<db::DataBox<DbTags>*> box,
+                             const TemporalId& temporal_id) noexcept {
+    if (db::get<::ah::Tags::FastFlow>(*box).current_iteration() == 0 and
+        not db::get<::ah::Tags::PreviousStrahlkorpers<Frame>>(*box).empty()) {
+      db::mutate<StrahlkorperTags::Strahlkorper<Frame>>(
+          box,
+          [&temporal_id](
+              const gsl::not_null<Strahlkorper<Frame>*> strahlkorper,
+              const db::item_type<::ah::Tags::PreviousStrahlkorpers<Frame>>&
+                  previous_strahlkorpers) noexcept {
+            *strahlkorper = ah::extrapolate_strahlkorper(
+                previous_strahlkorpers,
+                InterpolationTarget_detail::get_temporal_id_value(
+                    temporal_id));
+          },
+          db::get<::ah::Tags::PreviousStrahlkorpers<Frame>>(*box));
+    }
   }
 
   template <typename Metavariables, typename DbTags, typename TemporalId>
@@ -170,8 +201,11 @@ struct ApparentHorizon {
     const auto& fast_flow = db::get<::ah::Tags::FastFlow>(box);
     const auto& strahlkorper =
         db::get<StrahlkorperTags::Strahlkorper<Frame>>(box);
-
     const size_t L_mesh = fast_flow.current_l_mesh(strahlkorper);
+    // The prolonged Strahlkorper, and so its YlmSpherepack tables, is not
+    // kept between iterations: FastFlow::iterate_horizon_finder constructs
+    // its own at the same resolution, so keeping this one alone would not
+    // avoid recomputing the tables.
     const auto prolonged_strahlkorper =
         Strahlkorper<Frame>(L_mesh, L_mesh, strahlkorper);
 
@@ -17,6 +17,8 @@
 #include "Domain/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/Requires.hpp"
@@ -24,6 +26,7 @@
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
 #include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
 /// \cond
 // IWYU pragma: no_forward_declare db::DataBox
@@ -88,6 +91,38 @@ auto apply_callback(
   return true;
 }
 
+// The time of a temporal_id, for targets whose points depend on time.
+inline double get_temporal_id_value(const double time) noexcept {
+  return time;
+}
+
+inline double get_temporal_id_value(const TimeStepId& time_step_id) noexcept {
+  return time_step_id.substep_time().value();
+}
+
+CREATE_IS_CALLABLE(prepare_points)
+CREATE_IS_CALLABLE_V(prepare_points)
+
+// Calls compute_target_points::prepare_points if it exists.
+template <typename InterpolationTargetTag, typename DbTags,
+          typename TemporalId,
+          Requires<not is_prepare_points_callable_v<
+              typename InterpolationTargetTag::compute_target_points,
+              gsl::not_null<db::DataBox<DbTags>*>, TemporalId>> = nullptr>
+void prepare_points(const gsl::not_null<db::DataBox<DbTags>*> /*box*/,
+                    const TemporalId& /*temporal_id*/) noexcept {}
+
+template <typename InterpolationTargetTag, typename DbTags,
+          typename TemporalId,
+          Requires<is_prepare_points_callable_v<
+              typename InterpolationTargetTag::compute_target_points,
+              gsl::not_null<db::DataBox<DbTags>*>, TemporalId>> = nullptr>
+void prepare_points(const gsl::not_null<db::DataBox<DbTags>*> box,
+                    const TemporalId& temporal_id) noexcept {
+  InterpolationTargetTag::compute_target_points::prepare_points(box,
+                                                                temporal_id);
+}
+
 CREATE_HAS_STATIC_MEMBER_VARIABLE(fill_invalid_points_with)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(fill_invalid_points_with)
 
@@ -50,7 +50,12 @@ class SpanInterpolator : public PUP::able {
   /// Perform the interpolation of function represented by complex `values` at
   /// `source_points` to the requested `target_point`, returning the
   /// (complex) interpolation result.
-  std::complex<double> interpolate(
+  ///
+  /// The default implementation interpolates the real and imaginary parts
+  /// separately. It is virtual so that callers holding a `SpanInterpolator`
+  /// pointer, such as the CCE scri+ interpolation, use the specialized
+  /// complex implementation of the derived class when one is provided.
+  virtual std::complex<double> interpolate(
       const gsl::span<const double>& source_points,
       const gsl::span<const std::complex<double>>& values,
       double target_point) const noexcept;
@@ -3,20 +3,26 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <string>
 #include <tuple>
+#include <type_traits>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "NumericalAlgorithms/LinearOperators/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Time/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
@@ -44,6 +50,78 @@ struct FilterAllEvolvedVars<true, true> {
   template <typename EvolvedVarsTagList, typename... FilterTags>
   using f = std::integral_constant<bool, true>;
 };
+
+template <typename EvolvedVarsTagList, typename... FilterTags>
+constexpr bool filter_all_evolved_vars =
+    FilterAllEvolvedVars<sizeof...(FilterTags) ==
+                             tmpl::size<EvolvedVarsTagList>::value,
+                         std::is_same_v<EvolvedVarsTagList,
+                                        tmpl::list<FilterTags...>>>::
+        template f<EvolvedVarsTagList, FilterTags...>::value;
+
+// Filters the `TagsToFilter` in `vars` in place. The components of the tensors
+// are stored contiguously in the `Variables`, so each contiguous block of
+// filtered tensors is filtered with a single `apply_matrices` call on the
+// `Variables` buffer rather than one call per tensor component.
+template <typename... TagsToFilter, typename VariablesTags, size_t Dim>
+void filter_variables(
+    const gsl::not_null<Variables<VariablesTags>*> vars,
+    const std::array<std::reference_wrapper<const Matrix>, Dim>& filter,
+    const Index<Dim>& extents) noexcept {
+  if constexpr (filter_all_evolved_vars<VariablesTags, TagsToFilter...>) {
+    *vars = apply_matrices(filter, *vars, extents);
+  } else {
+    const size_t number_of_grid_points = vars->number_of_grid_points();
+    DataVector buffer{};
+    // The first component and the number of components of the block of
+    // filtered tensors being collected
+    size_t block_offset = 0;
+    size_t block_size = 0;
+    const auto filter_block = [&vars, &filter, &extents, &number_of_grid_points,
+                               &buffer, &block_offset,
+                               &block_size]() noexcept {
+      if (block_size == 0) {
+        return;
+      }
+      // clang-tidy: do not use pointer arithmetic
+      double* const block_data =
+          vars->data() + block_offset * number_of_grid_points;  // NOLINT
+      buffer.destructive_resize(block_size * number_of_grid_points);
+      apply_matrices_detail::Impl<double, Dim>::apply(
+          make_not_null(buffer.data()), filter, block_data, extents,
+          block_size);
+      std::copy(buffer.begin(), buffer.end(), block_data);
+      block_size = 0;
+    };
+    size_t component_offset = 0;
+    tmpl::for_each<VariablesTags>([&filter_block, &block_offset, &block_size,
+                                   &component_offset](auto tag_v) noexcept {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      if (tmpl::list_contains_v<tmpl::list<TagsToFilter...>, tag>) {
+        if (block_size == 0) {
+          block_offset = component_offset;
+        }
+        block_size += tag::type::size();
+      } else {
+        filter_block();
+      }
+      component_offset += tag::type::size();
+    });
+    filter_block();
+  }
+}
+
+template <typename FilterType, size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> filter_matrices(
+    const FilterType& filter_helper, const Mesh<Dim>& mesh) noexcept {
+  const Matrix empty{};
+  auto filter = make_array<Dim>(std::cref(empty));
+  for (size_t d = 0; d < Dim; d++) {
+    gsl::at(filter, d) =
+        std::cref(filter_helper.filter_matrix(mesh.slice_through(d)));
+  }
+  return filter;
+}
 }  // namespace Filter_detail
 
 /// \cond
@@ -93,59 +171,104 @@ class Filter<FilterType, tmpl::list<TagsToFilter...>> {
       const ParallelComponent* const /*meta*/) noexcept {
     constexpr size_t volume_dim = Metavariables::system::volume_dim;
     using evolved_vars_tag = typename Metavariables::system::variables_tag;
-    using evolved_vars_tags_list = typename evolved_vars_tag::tags_list;
     const FilterType& filter_helper =
         Parallel::get<::Filters::Tags::Filter<FilterType>>(cache);
     if (UNLIKELY(filter_helper.disable_for_debugging())) {
       return {std::move(box)};
     }
-    const Mesh<volume_dim> mesh = db::get<domain::Tags::Mesh<volume_dim>>(box);
-    const Matrix empty{};
-    auto filter = make_array<volume_dim>(std::cref(empty));
-    for (size_t d = 0; d < volume_dim; d++) {
-      gsl::at(filter, d) =
-          std::cref(filter_helper.filter_matrix(mesh.slice_through(d)));
-    }
+    static_assert(
+        tmpl2::flat_all_v<tmpl::list_contains_v<
+            typename evolved_vars_tag::tags_list, TagsToFilter>...>,
+        "Only evolved variables can be filtered.");
+    db::mutate<evolved_vars_tag>(
+        make_not_null(&box),
+        [&filter_helper](const gsl::not_null<db::item_type<evolved_vars_tag>*>
+                             vars,
+                         const Mesh<volume_dim>& mesh) noexcept {
+          Filter_detail::filter_variables<TagsToFilter...>(
+              vars, Filter_detail::filter_matrices(filter_helper, mesh),
+              mesh.extents());
+        },
+        db::get<domain::Tags::Mesh<volume_dim>>(box));
+    return {std::move(box)};
+  }
+};
 
-    // In the case that the tags we are filtering are all the evolved variables
-    // we filter the entire Variables at once to be more efficient. This case is
-    // the first branch of the `if-else`.
-    if (Filter_detail::FilterAllEvolvedVars<
-            sizeof...(TagsToFilter) ==
-                tmpl::size<evolved_vars_tags_list>::value,
-            std::is_same_v<evolved_vars_tags_list,
-                           tmpl::list<TagsToFilter...>>>::
-            template f<evolved_vars_tags_list, TagsToFilter...>::value) {
-      db::mutate<typename Metavariables::system::variables_tag>(
-          make_not_null(&box),
-          [&filter](
-              const gsl::not_null<
-                  db::item_type<typename Metavariables::system::variables_tag>*>
-                  vars,
-              const auto& local_mesh) noexcept {
-            *vars = apply_matrices(filter, *vars, local_mesh.extents());
-          },
-          mesh);
-    } else {
-      db::mutate<TagsToFilter...>(
-          make_not_null(&box),
-          [&filter](const gsl::not_null<
-                        db::item_type<TagsToFilter>*>... tensors_to_filter,
-                    const auto& local_mesh) noexcept {
-            DataVector temp(local_mesh.number_of_grid_points(), 0.0);
-            const auto helper =
-                [&local_mesh, &filter, &temp ](const auto tensor) noexcept {
-              for (auto& component : *tensor) {
-                temp = 0.0;
-                apply_matrices(make_not_null(&temp), filter, component,
-                               local_mesh.extents());
-                component = temp;
-              }
-            };
-            EXPAND_PACK_LEFT_TO_RIGHT(helper(tensors_to_filter));
-          },
-          mesh);
-    }
+/// \cond
+template <typename FilterType, typename TagsToFilterList>
+struct UpdateUAndFilter;
+/// \endcond
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Performs the variable update for one substep (see `Actions::UpdateU`)
+ * and applies a filter to the specified tags, fused into a single action.
+ *
+ * This is equivalent to `Actions::UpdateU<>` followed by
+ * `dg::Actions::Filter<FilterType, tmpl::list<TagsToFilter...>>`, but the
+ * evolved variables are only mutated once per substep and the filtered tensors
+ * are filtered with one `apply_matrices` call on each contiguous block of them
+ * in the evolved variables. Use it in place of the two actions for systems
+ * that are filtered every step.
+ *
+ * Uses:
+ * - ConstGlobalCache:
+ *   - `Filter`
+ * - DataBox:
+ *   - `Tags::Mesh`
+ *   - `Tags::HistoryEvolvedVariables<variables_tag>`
+ *   - `Tags::TimeStep`
+ *   - `Tags::TimeStepper<>`
+ * - DataBox changes:
+ *   - Adds: nothing
+ *   - Removes: nothing
+ *   - Modifies:
+ *     - `variables_tag`
+ *     - `Tags::HistoryEvolvedVariables<variables_tag>`
+ * - System:
+ *   - `volume_dim`
+ *   - `variables_tag`
+ */
+template <typename FilterType, typename... TagsToFilter>
+struct UpdateUAndFilter<FilterType, tmpl::list<TagsToFilter...>> {
+  using const_global_cache_tags =
+      tmpl::list<::Filters::Tags::Filter<FilterType>>;
+
+  template <typename DbTags, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent,
+            typename Metavariables>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    constexpr size_t volume_dim = Metavariables::system::volume_dim;
+    using evolved_vars_tag = typename Metavariables::system::variables_tag;
+    using history_tag = ::Tags::HistoryEvolvedVariables<evolved_vars_tag>;
+    static_assert(
+        tmpl2::flat_all_v<tmpl::list_contains_v<
+            typename evolved_vars_tag::tags_list, TagsToFilter>...>,
+        "Only evolved variables can be filtered.");
+    const FilterType& filter_helper =
+        Parallel::get<::Filters::Tags::Filter<FilterType>>(cache);
+
+    db::mutate<evolved_vars_tag, history_tag>(
+        make_not_null(&box),
+        [&filter_helper](
+            const gsl::not_null<db::item_type<evolved_vars_tag>*> vars,
+            const gsl::not_null<db::item_type<history_tag>*> history,
+            const ::TimeDelta& time_step, const auto& time_stepper,
+            const Mesh<volume_dim>& mesh) noexcept {
+          time_stepper.update_u(vars, history, time_step);
+          if (LIKELY(not filter_helper.disable_for_debugging())) {
+            Filter_detail::filter_variables<TagsToFilter...>(
+                vars, Filter_detail::filter_matrices(filter_helper, mesh),
+                mesh.extents());
+          }
+        },
+        db::get<::Tags::TimeStep>(box), db::get<::Tags::TimeStepper<>>(box),
+        db::get<domain::Tags::Mesh<volume_dim>>(box));
     return {std::move(box)};
   }
 };
@@ -0,0 +1,175 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Declares function RootFinder::lockstep_brent
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Exceptions.hpp"
+#include "Utilities/MakeString.hpp"
+
+namespace RootFinder {
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Finds the roots of the function `f` at every point of a `DataVector`
+ * simultaneously with Brent's method.
+ *
+ * `f` is a unary invokable that takes a `DataVector` holding the current guess
+ * at every point and returns a `DataVector` of the function values at those
+ * points. Unlike the `DataVector` overload of `RootFinder::toms748`, which
+ * performs an independent scalar root find at each point, all points are
+ * advanced together: each iteration performs a single call to `f` on the whole
+ * `DataVector`, so that `f` can be written with vectorized `DataVector`
+ * operations. Points that have already converged are not updated further, but
+ * are still passed to `f` (at their converged value) until all points have
+ * converged.
+ *
+ * \snippet Test_Brent.cpp lockstep_brent_root_find
+ *
+ * For each index `i`, Brent's method (inverse quadratic interpolation
+ * safeguarded by bisection) searches for a root in the interval
+ * [`lower_bound[i]`, `upper_bound[i]`]. A point is converged when the root is
+ * bracketed by an interval of width smaller than
+ * `absolute_tolerance + relative_tolerance * |x|`, which is the same criterion
+ * used by `RootFinder::toms748`.
+ *
+ * \requires Function `f` is invokable with a `DataVector` and returns a
+ * `DataVector` of the same size
+ *
+ * \throws `std::domain_error` if, for any index, the bounds do not bracket a
+ * root.
+ * \throws `convergence_error` if, for any index, the requested tolerance is not
+ * met after `max_iterations` iterations.
+ */
+template <typename Function>
+DataVector lockstep_brent(const Function& f, const DataVector& lower_bound,
+                          const DataVector& upper_bound,
+                          const double absolute_tolerance,
+                          const double relative_tolerance,
+                          const size_t max_iterations = 100) {
+  ASSERT(relative_tolerance > std::numeric_limits<double>::epsilon(),
+         "The relative tolerance is too small.");
+  ASSERT(lower_bound.size() == upper_bound.size(),
+         "The lower and upper bounds must have the same size, but have sizes "
+             << lower_bound.size() << " and " << upper_bound.size());
+  const size_t size = lower_bound.size();
+
+  // The notation follows the classic presentation of Brent's method: `b` is
+  // the current best estimate of the root, `c` is the point such that [b, c]
+  // brackets the root, and `a` is the previous value of `b`.
+  DataVector a = lower_bound;
+  DataVector b = upper_bound;
+  DataVector fa = f(a);
+  DataVector fb = f(b);
+  for (size_t s = 0; s < size; ++s) {
+    if ((fa[s] > 0.0 and fb[s] > 0.0) or (fa[s] < 0.0 and fb[s] < 0.0)) {
+      throw std::domain_error(MakeString{}
+                              << "lockstep_brent: the bounds do not bracket "
+                                 "the root at index "
+                              << s << ": f(" << a[s] << ") = " << fa[s]
+                              << ", f(" << b[s] << ") = " << fb[s]);
+    }
+  }
+  DataVector c = b;
+  DataVector fc = fb;
+  DataVector d(size, 0.0);
+  DataVector e(size, 0.0);
+  std::vector<bool> converged(size, false);
+  size_t number_converged = 0;
+
+  for (size_t iteration = 0;; ++iteration) {
+    for (size_t s = 0; s < size; ++s) {
+      if (converged[s]) {
+        continue;
+      }
+      if ((fb[s] > 0.0 and fc[s] > 0.0) or (fb[s] < 0.0 and fc[s] < 0.0)) {
+        c[s] = a[s];
+        fc[s] = fa[s];
+        d[s] = b[s] - a[s];
+        e[s] = d[s];
+      }
+      if (std::abs(fc[s]) < std::abs(fb[s])) {
+        a[s] = b[s];
+        b[s] = c[s];
+        c[s] = a[s];
+        fa[s] = fb[s];
+        fb[s] = fc[s];
+        fc[s] = fa[s];
+      }
+      const double tol =
+          0.5 * (absolute_tolerance + relative_tolerance * std::abs(b[s]));
+      const double half_width = 0.5 * (c[s] - b[s]);
+      if (std::abs(half_width) <= tol or fb[s] == 0.0) {
+        converged[s] = true;
+        ++number_converged;
+        continue;
+      }
+      if (std::abs(e[s]) >= tol and std::abs(fa[s]) > std::abs(fb[s])) {
+        // Attempt inverse quadratic interpolation, or the secant method if
+        // only two distinct points are available.
+        const double ratio_ba = fb[s] / fa[s];
+        double p = 0.0;
+        double q = 0.0;
+        if (a[s] == c[s]) {
+          p = 2.0 * half_width * ratio_ba;
+          q = 1.0 - ratio_ba;
+        } else {
+          const double ratio_ac = fa[s] / fc[s];
+          const double ratio_bc = fb[s] / fc[s];
+          p = ratio_ba * (2.0 * half_width * ratio_ac * (ratio_ac - ratio_bc) -
+                          (b[s] - a[s]) * (ratio_bc - 1.0));
+          q = (ratio_ac - 1.0) * (ratio_bc - 1.0) * (ratio_ba - 1.0);
+        }
+        if (p > 0.0) {
+          q = -q;
+        }
+        p = std::abs(p);
+        if (2.0 * p < std::min(3.0 * half_width * q - std::abs(tol * q),
+                               std::abs(e[s] * q))) {
+          e[s] = d[s];
+          d[s] = p / q;
+        } else {
+          d[s] = half_width;
+          e[s] = d[s];
+        }
+      } else {
+        // Bounds decreasing too slowly, use bisection
+        d[s] = half_width;
+        e[s] = d[s];
+      }
+      a[s] = b[s];
+      fa[s] = fb[s];
+      b[s] += std::abs(d[s]) > tol ? d[s] : std::copysign(tol, half_width);
+    }
+    if (number_converged == size) {
+      return b;
+    }
+    if (iteration == max_iterations) {
+      break;
+    }
+    // Only the unconverged points changed, but evaluating everything keeps
+    // `f` a single vectorized call.
+    const DataVector f_of_b = f(b);
+    for (size_t s = 0; s < size; ++s) {
+      if (not converged[s]) {
+        fb[s] = f_of_b[s];
+      }
+    }
+  }
+  throw convergence_error(MakeString{}
+                          << "lockstep_brent reached max iterations of "
+                          << max_iterations << " without converging at "
+                          << size - number_converged << " of " << size
+                          << " points.");
+}
+}  // namespace RootFinder
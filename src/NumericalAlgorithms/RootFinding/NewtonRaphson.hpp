@@ -2,13 +2,17 @@
 // See LICENSE.txt for details.
 
 /// \file
-/// Declares function RootFinder::newton_raphson
+/// Declares functions RootFinder::newton_raphson and
+/// RootFinder::lockstep_newton_raphson
 
 #pragma once
 
 #include <boost/math/tools/roots.hpp>
+#include <cmath>
 #include <functional>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "ErrorHandling/Exceptions.hpp"
@@ -117,4 +121,102 @@ DataVector newton_raphson(const Function& f, const DataVector& initial_guess,
   return result_vector;
 }
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Finds the roots of the function `f` at every point of a `DataVector`
+ * simultaneously with the Newton-Raphson method.
+ *
+ * `f` is a unary invokable that takes a `DataVector` holding the current guess
+ * at every point. `f` must return a `std::pair<DataVector, DataVector>` where
+ * the first element is the function value and the second element is the
+ * derivative of the function at every point. Unlike the `DataVector` overload
+ * of `RootFinder::newton_raphson`, which performs an independent scalar root
+ * find at each point, all points are advanced together: each iteration
+ * performs a single call to `f` on the whole `DataVector`, so that `f` can be
+ * written with vectorized `DataVector` operations. Points that have already
+ * converged are not updated further, but are still passed to `f` (at their
+ * converged value) until all points have converged.
+ *
+ * \snippet Test_NewtonRaphson.cpp lockstep_newton_raphson_root_find
+ *
+ * As for `RootFinder::newton_raphson`, the iterates are kept within
+ * [`lower_bound[i]`, `upper_bound[i]`]: a Newton step that would leave the
+ * interval is replaced by a bisection step towards the violated bound. A point
+ * is converged when the Newton step is smaller than the requested relative
+ * precision or the function vanishes.
+ *
+ * \requires Function `f` be callable with a `DataVector`
+ * \note The parameter `digits` specifies the precision of the result in its
+ * desired number of base-10 digits.
+ *
+ * \throws `convergence_error` if, for any index, the requested precision is not
+ * met after `max_iterations` iterations.
+ */
+template <typename Function>
+DataVector lockstep_newton_raphson(const Function& f,
+                                   const DataVector& initial_guess,
+                                   const DataVector& lower_bound,
+                                   const DataVector& upper_bound,
+                                   const size_t digits,
+                                   const size_t max_iterations = 50) {
+  ASSERT(digits < std::numeric_limits<double>::digits10,
+         "The desired accuracy of " << digits
+                                    << " base-10 digits must be smaller than "
+                                       "the machine numeric limit of "
+                                    << std::numeric_limits<double>::digits10
+                                    << " base-10 digits.");
+  // Same termination criterion as boost::math::tools::newton_raphson_iterate
+  const double factor =
+      std::ldexp(1.0, 1 - static_cast<int>(std::round(
+                              std::log2(std::pow(10, digits)))));
+
+  const size_t size = initial_guess.size();
+  DataVector result_vector = initial_guess;
+  std::vector<bool> converged(size, false);
+  size_t number_converged = 0;
+  for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+    const auto f_and_derivative = f(result_vector);
+    const DataVector& f_of_x = f_and_derivative.first;
+    const DataVector& derivative = f_and_derivative.second;
+    for (size_t s = 0; s < size; ++s) {
+      if (converged[s]) {
+        continue;
+      }
+      double& x = result_vector[s];
+      if (f_of_x[s] == 0.0) {
+        converged[s] = true;
+        ++number_converged;
+        continue;
+      }
+      double new_x = 0.0;
+      if (derivative[s] == 0.0) {
+        // No Newton step is possible, so bisect towards the farther bound.
+        new_x = 0.5 * (x + (x - lower_bound[s] > upper_bound[s] - x
+                                ? lower_bound[s]
+                                : upper_bound[s]));
+      } else {
+        new_x = x - f_of_x[s] / derivative[s];
+      }
+      if (new_x < lower_bound[s]) {
+        new_x = 0.5 * (x + lower_bound[s]);
+      } else if (new_x > upper_bound[s]) {
+        new_x = 0.5 * (x + upper_bound[s]);
+      }
+      if (std::abs(new_x - x) <= std::abs(new_x * factor)) {
+        converged[s] = true;
+        ++number_converged;
+      }
+      x = new_x;
+    }
+    if (number_converged == size) {
+      return result_vector;
+    }
+  }
+  throw convergence_error(MakeString{}
+                          << "lockstep_newton_raphson reached max iterations "
+                             "of "
+                          << max_iterations << " without converging at "
+                          << size - number_converged << " of " << size
+                          << " points.");
+}
 }  // namespace RootFinder
@@ -132,6 +132,15 @@ using get_component_if_mocked = tmpl::front<tmpl::type_from<tmpl::conditional_t<
 /// References to items in the ConstGlobalCache are also added to the
 /// db::DataBox of each `Component` in the `Metavariables::component_list` with
 /// the same tag with which they were inserted into the ConstGlobalCache.
+///
+/// Since the ConstGlobalCache is a nodegroup, each item is stored once per
+/// Charm++ node (i.e. once per process in SMP mode) and `Parallel::get`
+/// returns a reference to that single copy on every PE of the node. Large
+/// objects such as the `Domain` or analytic data should therefore be placed in
+/// the ConstGlobalCache rather than copied into the DataBox of each element.
+/// Because the items are read concurrently by all the PEs of a node, they must
+/// not be modified after construction, which includes not holding `mutable`
+/// lazily-computed state.
 template <typename Metavariables>
 class ConstGlobalCache : public CBase_ConstGlobalCache<Metavariables> {
   using parallel_component_tag_list = tmpl::transform<
@@ -249,7 +258,8 @@ auto get_parallel_component(
 ///
 /// \requires ConstGlobalCacheTag is a tag in tag_list
 ///
-/// \returns a constant reference to an object in the cache
+/// \returns a constant reference to an object in the cache, which is shared
+/// by all PEs on the Charm++ node
 template <typename ConstGlobalCacheTag, typename Metavariables>
 auto get(const ConstGlobalCache<Metavariables>& cache) noexcept -> const
     ConstGlobalCache_detail::type_for_get<ConstGlobalCacheTag, Metavariables>& {
@@ -20,6 +20,7 @@
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/CreateFromOptions.hpp"
 #include "Parallel/Exit.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Printf.hpp"
 #include "Parallel/TypeTraits.hpp"
@@ -27,10 +28,49 @@
 #include "Utilities/Overloader.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
 #include "Parallel/Main.decl.h"
 
 namespace Parallel {
+namespace Main_detail {
+CREATE_IS_CALLABLE(phase_name)
+CREATE_IS_CALLABLE_V(phase_name)
+
+// The name of the phase if the metavariables provide a `phase_name`
+// function, and its number otherwise
+template <typename Metavariables>
+std::string phase_name(const typename Metavariables::Phase phase) noexcept {
+  if constexpr (is_phase_name_callable_v<Metavariables,
+                                         typename Metavariables::Phase>) {
+    return Metavariables::phase_name(phase);
+  } else {
+    return std::to_string(static_cast<int>(phase));
+  }
+}
+
+CREATE_HAS_STATIC_MEMBER_VARIABLE(execute_exit_phase)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(execute_exit_phase)
+
+// Whether the `execute_next_phase` function of the component is also called
+// for the `Exit` phase, which a component requests by declaring
+// `static constexpr bool execute_exit_phase = true;`
+template <typename Component>
+constexpr bool executes_exit_phase() noexcept {
+  if constexpr (has_execute_exit_phase_v<Component, bool>) {
+    return Component::execute_exit_phase;
+  } else {
+    return false;
+  }
+}
+
+template <typename... Components>
+constexpr bool any_executes_exit_phase(
+    tmpl::list<Components...> /*meta*/) noexcept {
+  return (executes_exit_phase<Components>() or ...);
+}
+}  // namespace Main_detail
 
 /// \ingroup ParallelGroup
 /// The main function of a Charm++ executable.
@@ -85,6 +125,8 @@ class Main : public CBase_Main<Metavariables> {
           tmpl::bind<Parallel::proxy_from_parallel_component, tmpl::_1>>>;
   typename Metavariables::Phase current_phase_{
       Metavariables::Phase::Initialization};
+  // Wall time at which the current phase started
+  double phase_start_time_{0.0};
 
   CProxy_ConstGlobalCache<Metavariables> const_global_cache_proxy_;
   Options<option_list> options_;
@@ -361,6 +403,7 @@ void Main<Metavariables>::
       tmpl::filter<component_list,
                    Parallel::is_array_proxy<tmpl::bind<
                        Parallel::proxy_from_parallel_component, tmpl::_1>>>;
+  const double allocation_start_time = Parallel::wall_time();
   tmpl::for_each<array_component_list>([ this, &items_from_options ](
       auto parallel_component_v) noexcept {
     using parallel_component = tmpl::type_from<decltype(parallel_component_v)>;
@@ -370,6 +413,9 @@ void Main<Metavariables>::
             items_from_options,
             typename parallel_component::initialization_tags{}));
   });
+  phase_start_time_ = Parallel::wall_time();
+  Informer::print_timing_info("Allocating the array components",
+                              phase_start_time_ - allocation_start_time);
   tmpl::for_each<component_list>([this](auto parallel_component_v) noexcept {
     using parallel_component = tmpl::type_from<decltype(parallel_component_v)>;
     Parallel::get_parallel_component<parallel_component>(
@@ -382,15 +428,35 @@ void Main<Metavariables>::
 
 template <typename Metavariables>
 void Main<Metavariables>::execute_next_phase() noexcept {
+  // The phase ends once quiescence is detected, so this includes the time
+  // the elements spent on it on all processors
+  const double phase_end_time = Parallel::wall_time();
+  if (Metavariables::Phase::Exit == current_phase_) {
+    Informer::print_exit_info();
+    Parallel::exit();
+  }
+  Informer::print_timing_info(
+      "Phase " + Main_detail::phase_name<Metavariables>(current_phase_),
+      phase_end_time - phase_start_time_);
   current_phase_ = Metavariables::determine_next_phase(
       current_phase_, const_global_cache_proxy_);
-  if (Metavariables::Phase::Exit == current_phase_) {
+  phase_start_time_ = phase_end_time;
+  // Only the components that request it are told about the Exit phase, so they
+  // can finish up, e.g. write buffered data to disk. The executable exits once
+  // they are done, or right away if there are no such components.
+  if (Metavariables::Phase::Exit == current_phase_ and
+      not Main_detail::any_executes_exit_phase(component_list{})) {
     Informer::print_exit_info();
     Parallel::exit();
   }
-  tmpl::for_each<component_list>([this](auto parallel_component) noexcept {
-    tmpl::type_from<decltype(parallel_component)>::execute_next_phase(
-        current_phase_, const_global_cache_proxy_);
+  tmpl::for_each<component_list>([this](auto parallel_component_v) noexcept {
+    using parallel_component =
+        tmpl::type_from<decltype(parallel_component_v)>;
+    if (Metavariables::Phase::Exit != current_phase_ or
+        Main_detail::executes_exit_phase<parallel_component>()) {
+      parallel_component::execute_next_phase(current_phase_,
+                                             const_global_cache_proxy_);
+    }
   });
   CkStartQD(CkCallback(CkIndex_Main<Metavariables>::execute_next_phase(),
                        this->thisProxy));
@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+/// \ingroup ParallelGroup
+/// The quantities counted by `Parallel::PerformanceCounters`
+enum class PerformanceCounter {
+  /// Evaluations of the time derivative
+  RhsEvaluations,
+  /// Calls to the limiter that modified the solution
+  LimiterActivations,
+  /// Messages sent to neighboring elements
+  MessagesSent
+};
+
+inline std::ostream& operator<<(std::ostream& os,
+                                const PerformanceCounter counter) noexcept {
+  switch (counter) {
+    case PerformanceCounter::RhsEvaluations:
+      return os << "RhsEvaluations";
+    case PerformanceCounter::LimiterActivations:
+      return os << "LimiterActivations";
+    case PerformanceCounter::MessagesSent:
+      return os << "MessagesSent";
+    default:
+      ERROR("Unknown PerformanceCounter");
+  }
+}
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Counts of the work done by a single element of an array component.
+ *
+ * \details The counts are accumulated from the start of the run. They are
+ * incremented in the actions that do the work (see
+ * `Parallel::increment_performance_counter`) if the DataBox holds a
+ * `Parallel::Tags::PerformanceCounters`, and observed with
+ * `dg::Events::ObservePerformanceCounters`.
+ */
+class PerformanceCounters {
+ public:
+  /// All the counters, in the order they are observed
+  using counters = std::array<PerformanceCounter, 3>;
+  static constexpr counters all_counters{
+      {PerformanceCounter::RhsEvaluations,
+       PerformanceCounter::LimiterActivations,
+       PerformanceCounter::MessagesSent}};
+  static constexpr size_t number_of_counters = all_counters.size();
+
+  void increment(const PerformanceCounter counter,
+                 const size_t amount = 1) noexcept {
+    gsl::at(counts_, static_cast<size_t>(counter)) += amount;
+  }
+
+  size_t operator[](const PerformanceCounter counter) const noexcept {
+    return gsl::at(counts_, static_cast<size_t>(counter));
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept { p | counts_; }
+
+ private:
+  friend bool operator==(const PerformanceCounters& lhs,
+                         const PerformanceCounters& rhs) noexcept {
+    return lhs.counts_ == rhs.counts_;
+  }
+
+  std::array<size_t, number_of_counters> counts_{};
+};
+
+inline bool operator!=(const PerformanceCounters& lhs,
+                       const PerformanceCounters& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ParallelGroup
+/// The performance counters of an element
+struct PerformanceCounters : db::SimpleTag {
+  using type = Parallel::PerformanceCounters;
+};
+}  // namespace Tags
+
+/// \ingroup ParallelGroup
+/// Increment `counter` by `amount` if the DataBox holds the performance
+/// counters, otherwise do nothing.
+template <typename DbTagsList>
+void increment_performance_counter(
+    const gsl::not_null<db::DataBox<DbTagsList>*> box,
+    const PerformanceCounter counter, const size_t amount = 1) noexcept {
+  if constexpr (tmpl::list_contains_v<DbTagsList, Tags::PerformanceCounters>) {
+    db::mutate<Tags::PerformanceCounters>(
+        box, [&counter, &amount](const gsl::not_null<PerformanceCounters*>
+                                     counters) noexcept {
+          counters->increment(counter, amount);
+        });
+  } else {
+    static_cast<void>(box);
+    static_cast<void>(counter);
+    static_cast<void>(amount);
+  }
+}
+}  // namespace Parallel
@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <string>
+
+#include "ErrorHandling/Error.hpp"
+
+/// \cond
+#define DEFINE_PHASES_DETAIL_CASE(r, data, phase) \
+  case Phase::phase:                              \
+    return BOOST_PP_STRINGIZE(phase);
+/// \endcond
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Defines the `Phase` enum of the metavariables with the listed phases,
+ * and a static `phase_name` function that returns the name of a phase.
+ *
+ * `Parallel::Main` reports the time spent in each phase under the name given by
+ * `phase_name`, or under the number of the phase if the metavariables don't
+ * define it.
+ *
+ * \example
+ * \code
+ * struct Metavariables {
+ *   DEFINE_PHASES(Initialization, Evolve, Exit)
+ *   ...
+ * };
+ * \endcode
+ */
+#define DEFINE_PHASES(...)                                               \
+  enum class Phase { __VA_ARGS__ };                                      \
+  static std::string phase_name(const Phase phase) noexcept {            \
+    switch (phase) {                                                     \
+      BOOST_PP_SEQ_FOR_EACH(DEFINE_PHASES_DETAIL_CASE, _,                \
+                            BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))       \
+      default:                                                           \
+        ERROR("Unknown phase " << static_cast<int>(phase));              \
+    }                                                                    \
+  }
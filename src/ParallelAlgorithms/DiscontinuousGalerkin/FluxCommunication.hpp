@@ -23,6 +23,7 @@
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/InboxInserters.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/PerformanceCounters.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/HasReceivedFromAllMortars.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
@@ -142,6 +143,9 @@ struct SendDataForFluxes {
                                std::move(remote_boundary_data_on_mortar))));
       }
     }
+    Parallel::increment_performance_counter(
+        make_not_null(&box), Parallel::PerformanceCounter::MessagesSent,
+        element.number_of_neighbors());
     return {std::move(box)};
   }
 };
@@ -13,6 +13,7 @@
 #include "Domain/FaceNormal.hpp"
 #include "Domain/InterfaceComputeTags.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "ParallelAlgorithms/Initialization/MergeIntoDataBox.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -78,8 +79,11 @@ struct InitExteriorVarsImpl<true, Metavariables> {
           mesh.slice_away(direction.dimension()).number_of_grid_points()};
     }
     return ::Initialization::merge_into_databox<
-        InitExteriorVarsImpl, db::AddSimpleTags<exterior_vars_tag>>(
-        std::move(box), std::move(exterior_boundary_vars));
+        InitExteriorVarsImpl,
+        db::AddSimpleTags<exterior_vars_tag,
+                          ::Tags::DirichletBoundaryDataCoordinates<dim>>>(
+        std::move(box), std::move(exterior_boundary_vars),
+        db::item_type<::Tags::DirichletBoundaryDataCoordinates<dim>>{});
   }
 };
 }  // namespace InitializeInterfaces_detail
@@ -99,7 +103,8 @@ struct InitExteriorVarsImpl<true, Metavariables> {
 ///
 /// By default, this initializer also adds the system's `variables_tag` on
 /// exterior (ghost) boundary faces. These are stored in a simple tag and
-/// updated manually to impose boundary conditions. Set the
+/// updated manually to impose boundary conditions, along with the coordinates
+/// at which they were last computed. Set the
 /// `AddExteriorVariables` template parameter to `false` to disable this
 /// behavior.
 ///
@@ -113,6 +118,7 @@ struct InitExteriorVarsImpl<true, Metavariables> {
 /// - Adds:
 ///   * `Tags::Interface<Tags::BoundaryDirectionsExterior<volume_dim>,
 ///   variables_tag>` (as a simple tag)
+///   * `Tags::DirichletBoundaryDataCoordinates<volume_dim>`
 ///   * `face_tags<Tags::InternalDirections<Dim>>`
 ///   * `face_tags<Tags::BoundaryDirectionsInterior<Dim>>`
 ///   * `face_tags<Tags::BoundaryDirectionsExterior<Dim>>`
@@ -123,6 +129,10 @@ struct InitExteriorVarsImpl<true, Metavariables> {
 ///   * `Tags::Interface<Directions, Tags::Mesh<Dim - 1>>`
 ///   * `Tags::Interface<Directions, Tags::Coordinates<Dim, Frame::Inertial>>`
 ///   (only on exterior faces)
+///   * `Tags::Interface<Directions, Tags::Coordinates<Dim, Frame::Grid>>`
+///   (only if `UseMovingMesh` is `true`)
+///   * `Tags::Interface<Directions, Tags::UnnormalizedFaceNormal<Dim,
+///   Frame::Grid>>` (only if `UseMovingMesh` is `true`)
 ///   * `Tags::Interface<Directions, Tags::UnnormalizedFaceNormal<Dim>>`
 ///   * `Tags::Interface<Directions, Tags::Magnitude<
 ///   Tags::UnnormalizedFaceNormal<Dim>>>`
@@ -151,6 +161,17 @@ struct InitializeInterfaces {
   struct make_compute_tag {
     using type = domain::Tags::InterfaceCompute<Directions, ComputeTag>;
   };
+  // The time-independent grid geometry on the faces from which the inertial
+  // coordinates and normals are computed on a moving mesh
+  template <typename Directions>
+  using moving_mesh_face_tags = tmpl::conditional_t<
+      UseMovingMesh,
+      tmpl::list<domain::Tags::InterfaceCompute<
+                     Directions, domain::Tags::BoundaryGridCoordinates<dim>>,
+                 domain::Tags::InterfaceCompute<
+                     Directions, domain::Tags::UnnormalizedFaceNormalCompute<
+                                     dim, Frame::Grid>>>,
+      tmpl::list<>>;
   template <typename Directions>
   using face_tags = tmpl::flatten<tmpl::list<
       Directions,
@@ -159,6 +180,7 @@ struct InitializeInterfaces {
                                      domain::Tags::InterfaceMesh<dim>>,
       tmpl::transform<SliceTagsToFace,
                       make_slice_tag<tmpl::_1, tmpl::pin<Directions>>>,
+      moving_mesh_face_tags<Directions>,
       domain::Tags::InterfaceCompute<
           Directions,
           tmpl::conditional_t<
@@ -187,6 +209,7 @@ struct InitializeInterfaces {
           make_slice_tag<
               tmpl::_1,
               tmpl::pin<domain::Tags::BoundaryDirectionsExterior<dim>>>>,
+      moving_mesh_face_tags<domain::Tags::BoundaryDirectionsExterior<dim>>,
       domain::Tags::InterfaceCompute<
           domain::Tags::BoundaryDirectionsExterior<dim>,
           domain::Tags::BoundaryCoordinates<dim, UseMovingMesh>>,
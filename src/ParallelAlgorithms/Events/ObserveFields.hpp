@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <map>
 #include <pup.h>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -22,6 +26,9 @@
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
 #include "IO/Observer/VolumeActions.hpp"      // IWYU pragma: keep
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/CharmPupable.hpp"
@@ -30,6 +37,8 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/CachedFunction.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
@@ -37,8 +46,6 @@
 #include "Utilities/TMPL.hpp"
 
 /// \cond
-template <size_t Dim>
-class Mesh;
 namespace Frame {
 struct Inertial;
 }  // namespace Frame
@@ -83,6 +90,11 @@ class ObserveFields;  // IWYU pragma: keep
  * - `Error(*)` = errors in `AnalyticSolutionTensors` =
  *   \f$\text{value} - \text{analytic solution}\f$
  *
+ * If `ObservationGridPoints` is nonzero, the data are interpolated to a mesh
+ * with that many grid points per dimension (but never more than the element's
+ * own mesh) and the same basis and quadrature before being observed. This
+ * reduces the amount of data written, e.g. for frequent visualization output.
+ *
  * \warning Currently, only one volume observation event can be
  * triggered at a given time.  Causing multiple events to run at once
  * will produce unpredictable results.
@@ -119,7 +131,15 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     static size_t lower_bound_on_size() noexcept { return 1; }
   };
 
-  using options = tmpl::list<VariablesToObserve>;
+  struct ObservationGridPoints {
+    static constexpr OptionString help =
+        "Number of grid points per dimension to interpolate the data to before "
+        "observing it (at least 2), or 0 to observe on the element mesh";
+    using type = size_t;
+    static type default_value() noexcept { return 0; }
+  };
+
+  using options = tmpl::list<VariablesToObserve, ObservationGridPoints>;
   static constexpr OptionString help =
       "Observe volume tensor fields.\n"
       "\n"
@@ -129,16 +149,27 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       " * Error(*) = errors in AnalyticSolutionTensors\n"
       "            = value - analytic solution\n"
       "\n"
+      "If ObservationGridPoints is nonzero, the data are interpolated to a\n"
+      "mesh with that many points per dimension before being observed.\n"
+      "\n"
       "Warning: Currently, only one volume observation event can be\n"
       "triggered at a given time.  Causing multiple events to run at once\n"
       "will produce unpredictable results.";
 
   explicit ObserveFields(const std::vector<std::string>& variables_to_observe =
                              VariablesToObserve::default_value(),
+                         const size_t observation_grid_points =
+                             ObservationGridPoints::default_value(),
                          const OptionContext& context = {})
       : variables_to_observe_(variables_to_observe.begin(),
-                              variables_to_observe.end()) {
+                              variables_to_observe.end()),
+        observation_grid_points_(observation_grid_points) {
     using ::operator<<;
+    if (observation_grid_points_ == 1) {
+      PARSE_ERROR(context,
+                  "ObservationGridPoints must be 0 (observe on the element "
+                  "mesh) or at least 2, but is 1");
+    }
     const std::unordered_set<std::string> valid_tensors{
         db::tag_name<Tensors>()...};
     for (const auto& name : variables_to_observe_) {
@@ -178,6 +209,46 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     const std::string element_name =
         MakeString{} << ElementId<VolumeDim>(array_index) << '/';
 
+    // The mesh the data is observed on, and the interpolant to it if it
+    // differs from the element mesh
+    Mesh<VolumeDim> observation_mesh = mesh;
+    const intrp::RegularGrid<VolumeDim>* interpolant = nullptr;
+    if (observation_grid_points_ != 0) {
+      std::array<size_t, VolumeDim> observation_extents{};
+      for (size_t d = 0; d < VolumeDim; ++d) {
+        gsl::at(observation_extents, d) =
+            std::min(observation_grid_points_, mesh.extents(d));
+      }
+      observation_mesh = Mesh<VolumeDim>{observation_extents, mesh.basis(),
+                                         mesh.quadrature()};
+      if (observation_mesh != mesh) {
+        // The interpolant depends only on the two meshes, so it is built once
+        // per thread for each element mesh and shared between the elements
+        using interpolant_key = std::tuple<
+            std::array<size_t, VolumeDim>,
+            std::array<Spectral::Basis, VolumeDim>,
+            std::array<Spectral::Quadrature, VolumeDim>,
+            std::array<size_t, VolumeDim>>;
+        static thread_local auto interpolants =
+            make_cached_function<interpolant_key, std::map>(
+                [](const interpolant_key& key) noexcept {
+                  const auto& [extents, bases, quadratures, target_extents] =
+                      key;
+                  return intrp::RegularGrid<VolumeDim>{
+                      Mesh<VolumeDim>{extents, bases, quadratures},
+                      Mesh<VolumeDim>{target_extents, bases, quadratures}};
+                });
+        interpolant =
+            &interpolants(interpolant_key{mesh.extents().indices(),
+                                          mesh.basis(), mesh.quadrature(),
+                                          observation_extents});
+      }
+    }
+    const auto observed_data = [interpolant](DataVector data) noexcept {
+      return interpolant != nullptr ? interpolant->interpolate(data)
+                                    : std::move(data);
+    };
+
     // Remove tensor types, only storing individual components.
     std::vector<TensorComponent> components;
     // This is larger than we need if we are only observing some
@@ -190,14 +261,15 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
             NonSolutionTensors::type::size()...},
         0_st));
 
-    const auto record_tensor_components = [ this, &components, &element_name ](
-        const auto tensor_tag_v, const auto& tensor) noexcept {
+    const auto record_tensor_components = [
+      this, &components, &element_name, &observed_data
+    ](const auto tensor_tag_v, const auto& tensor) noexcept {
       using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
       if (variables_to_observe_.count(db::tag_name<tensor_tag>()) == 1) {
         for (size_t i = 0; i < tensor.size(); ++i) {
           components.emplace_back(element_name + db::tag_name<tensor_tag>() +
                                       tensor.component_suffix(i),
-                                  tensor[i]);
+                                  observed_data(tensor[i]));
         }
       }
     };
@@ -208,9 +280,10 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     EXPAND_PACK_LEFT_TO_RIGHT(record_tensor_components(
         tmpl::type_<NonSolutionTensors>{}, non_solution_tensors));
 
-    const auto record_errors = [ this, &components, &element_name ](
-        const auto tensor_tag_v, const auto& tensor,
-        const auto& analytic_tensor) noexcept {
+    const auto record_errors = [
+      this, &components, &element_name, &observed_data
+    ](const auto tensor_tag_v, const auto& tensor,
+      const auto& analytic_tensor) noexcept {
       using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
       if (variables_to_observe_.count(db::tag_name<tensor_tag>()) == 1) {
         for (size_t i = 0; i < tensor.size(); ++i) {
@@ -218,7 +291,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
           components.emplace_back(element_name + "Error(" +
                                       db::tag_name<tensor_tag>() + ")" +
                                       tensor.component_suffix(i),
-                                  std::move(error));
+                                  observed_data(std::move(error)));
         }
       }
     };
@@ -242,17 +315,19 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         observers::ArrayComponentId(
             std::add_pointer_t<ParallelComponent>{nullptr},
             Parallel::ArrayIndex<ElementId<VolumeDim>>(array_index)),
-        std::move(components), mesh.extents());
+        std::move(components), observation_mesh.extents());
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) noexcept override {
     Event<EventRegistrars>::pup(p);
     p | variables_to_observe_;
+    p | observation_grid_points_;
   }
 
  private:
   std::unordered_set<std::string> variables_to_observe_{};
+  size_t observation_grid_points_{0};
 };
 
 /// \cond
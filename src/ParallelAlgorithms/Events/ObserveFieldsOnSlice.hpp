@@ -0,0 +1,394 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/VolumeActions.hpp"      // IWYU pragma: keep
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/MakeString.hpp"
+#include "Utilities/StdHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+/// \endcond
+
+namespace dg {
+namespace Events {
+namespace ObserveFieldsOnSlice_detail {
+/*!
+ * \brief Finds where the plane `coordinate == slice_value` cuts the element.
+ *
+ * Returns the logical dimension along which `coordinate` varies and the logical
+ * coordinate in that dimension at which it equals `slice_value`. Returns an
+ * empty optional if the plane doesn't intersect the element, or if
+ * `coordinate` is not a function of a single logical coordinate, in which case
+ * the plane isn't a logical slice of the element.
+ *
+ * A plane on a face the element shares with a neighbor must be observed by
+ * only one of the two elements, so the face values of `coordinate` are
+ * compared to `slice_value` within roundoff and the plane is assigned to the
+ * element on whose face `coordinate` takes its smaller value. A plane on the
+ * face with the larger value is therefore only observed if that face is one of
+ * the `external_boundaries`, i.e. the plane lies on the outer boundary of the
+ * domain.
+ */
+template <size_t Dim>
+std::optional<std::pair<size_t, double>> logical_slice(
+    const Mesh<Dim>& mesh, const DataVector& coordinate,
+    const double slice_value,
+    const std::unordered_set<Direction<Dim>>& external_boundaries) noexcept {
+  constexpr double eps = std::numeric_limits<double>::epsilon() * 100.0;
+  const double coordinate_scale = max(abs(coordinate));
+  size_t stride = 1;
+  for (size_t logical_dim = 0; logical_dim < Dim; ++logical_dim) {
+    // the value on the line of points through the origin of the other
+    // logical dimensions
+    const auto value_on_line = [&coordinate, &logical_dim,
+                                &stride](const Index<Dim>& index) noexcept {
+      return coordinate[index[logical_dim] * stride];
+    };
+    bool varies_only_in_logical_dim = true;
+    for (IndexIterator<Dim> it(mesh.extents()); it; ++it) {
+      if (not equal_within_roundoff(coordinate[it.collapsed_index()],
+                                    value_on_line(*it), eps,
+                                    coordinate_scale)) {
+        varies_only_in_logical_dim = false;
+        break;
+      }
+    }
+    if (not varies_only_in_logical_dim) {
+      stride *= mesh.extents(logical_dim);
+      continue;
+    }
+
+    const Mesh<1> mesh_1d = mesh.slice_through(logical_dim);
+    DataVector line(mesh_1d.number_of_grid_points());
+    for (size_t i = 0; i < line.size(); ++i) {
+      line[i] = coordinate[i * stride];
+    }
+    // The barycentric weights of the collocation points are computed once, so
+    // each evaluation of the interpolant in the root find is O(N)
+    const DataVector& collocation_points =
+        Spectral::collocation_points(mesh_1d);
+    DataVector weights(line.size(), 1.0);
+    for (size_t j = 0; j < line.size(); ++j) {
+      for (size_t k = 0; k < line.size(); ++k) {
+        if (k != j) {
+          weights[j] /= collocation_points[j] - collocation_points[k];
+        }
+      }
+    }
+    const auto coordinate_at = [&collocation_points, &line,
+                                &weights](const double logical_coord) noexcept {
+      double numerator = 0.0;
+      double denominator = 0.0;
+      for (size_t j = 0; j < line.size(); ++j) {
+        const double difference = logical_coord - collocation_points[j];
+        if (difference == 0.0) {
+          return line[j];
+        }
+        numerator += weights[j] * line[j] / difference;
+        denominator += weights[j] / difference;
+      }
+      return numerator / denominator;
+    };
+    const double lower_face_value = coordinate_at(-1.0);
+    const double upper_face_value = coordinate_at(1.0);
+    const bool increasing = upper_face_value > lower_face_value;
+    const double min_value = std::min(lower_face_value, upper_face_value);
+    const double max_value = std::max(lower_face_value, upper_face_value);
+    const double width = max_value - min_value;
+    if (equal_within_roundoff(slice_value, min_value, eps, width)) {
+      return std::make_pair(logical_dim, increasing ? -1.0 : 1.0);
+    }
+    if (equal_within_roundoff(slice_value, max_value, eps, width)) {
+      const Direction<Dim> max_face(logical_dim,
+                                    increasing ? Side::Upper : Side::Lower);
+      if (external_boundaries.count(max_face) == 1) {
+        return std::make_pair(logical_dim, increasing ? 1.0 : -1.0);
+      }
+      return std::nullopt;
+    }
+    if (slice_value < min_value or slice_value > max_value) {
+      return std::nullopt;
+    }
+    return std::make_pair(
+        logical_dim,
+        RootFinder::toms748(
+            [&coordinate_at, &slice_value](const double logical_coord) {
+              return coordinate_at(logical_coord) - slice_value;
+            },
+            -1.0, 1.0, 1.0e-14, 1.0e-12));
+  }
+  return std::nullopt;
+}
+}  // namespace ObserveFieldsOnSlice_detail
+
+template <size_t VolumeDim, typename ObservationValueTag, typename Tensors,
+          typename EventRegistrars>
+class ObserveFieldsOnSlice;
+
+namespace Registrars {
+template <size_t VolumeDim, typename ObservationValueTag, typename Tensors>
+struct ObserveFieldsOnSlice {
+  template <typename RegistrarList>
+  using f = Events::ObserveFieldsOnSlice<VolumeDim, ObservationValueTag,
+                                         Tensors, RegistrarList>;
+};
+}  // namespace Registrars
+
+template <size_t VolumeDim, typename ObservationValueTag, typename Tensors,
+          typename EventRegistrars =
+              tmpl::list<Registrars::ObserveFieldsOnSlice<
+                  VolumeDim, ObservationValueTag, Tensors>>>
+class ObserveFieldsOnSlice;  // IWYU pragma: keep
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief %Observe volume tensor fields on a coordinate-aligned slice, e.g. the
+ * \f$z=0\f$ plane.
+ *
+ * Each element that the plane `SliceCoordinate` in the inertial direction
+ * `SliceDimension` passes through interpolates its data to the plane and
+ * writes it, along with the `InertialCoordinates`, to the volume subfile
+ * `SubfileName`. The data of an element have an extent of 1 in the logical
+ * dimension normal to the slice. Elements the plane does not intersect write
+ * nothing, so the amount of data written scales with the area of the slice
+ * rather than the volume of the domain. A plane on a boundary between two
+ * elements is observed by only one of them, and a plane on the outer boundary
+ * of the domain is observed by the elements on that boundary.
+ *
+ * The slice is found in the logical coordinates of each element, so the
+ * inertial coordinate in the `SliceDimension` must be a function of a single
+ * logical coordinate in the elements the plane passes through. This is the
+ * case, e.g., for the rectilinear domains, and for planes through the center
+ * of the spherical domains that contain the faces of the wedges. Elements for
+ * which this doesn't hold are not observed.
+ *
+ * \warning Currently, only one volume observation event can be
+ * triggered at a given time.  Causing multiple events to run at once
+ * will produce unpredictable results.
+ */
+template <size_t VolumeDim, typename ObservationValueTag, typename... Tensors,
+          typename EventRegistrars>
+class ObserveFieldsOnSlice<VolumeDim, ObservationValueTag,
+                           tmpl::list<Tensors...>, EventRegistrars>
+    : public Event<EventRegistrars> {
+ private:
+  using coordinates_tag = domain::Tags::Coordinates<VolumeDim, Frame::Inertial>;
+
+ public:
+  /// \cond
+  explicit ObserveFieldsOnSlice(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveFieldsOnSlice);  // NOLINT
+  /// \endcond
+
+  struct SubfileName {
+    static constexpr OptionString help =
+        "The name of the volume subfile to write the slice to, without a "
+        "leading '/'";
+    using type = std::string;
+    static type default_value() noexcept { return "slice_data"; }
+  };
+
+  struct VariablesToObserve {
+    static constexpr OptionString help = "Subset of variables to observe";
+    using type = std::vector<std::string>;
+    static type default_value() noexcept {
+      return {db::tag_name<Tensors>()...};
+    }
+    static size_t lower_bound_on_size() noexcept { return 1; }
+  };
+
+  struct SliceDimension {
+    static constexpr OptionString help =
+        "Inertial dimension normal to the slice (0 for x, 1 for y, 2 for z)";
+    using type = size_t;
+    static type upper_bound() noexcept { return VolumeDim - 1; }
+  };
+
+  struct SliceCoordinate {
+    static constexpr OptionString help =
+        "Inertial coordinate of the slice in the SliceDimension";
+    using type = double;
+  };
+
+  using options = tmpl::list<SubfileName, VariablesToObserve, SliceDimension,
+                             SliceCoordinate>;
+  static constexpr OptionString help =
+      "Observe volume tensor fields on a coordinate-aligned slice.\n"
+      "\n"
+      "Writes the InertialCoordinates and the observed tensors, interpolated\n"
+      "to the plane SliceCoordinate in the inertial SliceDimension, from the\n"
+      "elements the plane passes through to the volume subfile SubfileName.\n"
+      "\n"
+      "Warning: Currently, only one volume observation event can be\n"
+      "triggered at a given time.  Causing multiple events to run at once\n"
+      "will produce unpredictable results.";
+
+  ObserveFieldsOnSlice() = default;
+
+  ObserveFieldsOnSlice(const std::string& subfile_name,
+                       const std::vector<std::string>& variables_to_observe,
+                       const size_t slice_dimension,
+                       const double slice_coordinate,
+                       const OptionContext& context = {})
+      : subfile_path_("/" + subfile_name),
+        variables_to_observe_(variables_to_observe.begin(),
+                              variables_to_observe.end()),
+        slice_dimension_(slice_dimension),
+        slice_coordinate_(slice_coordinate) {
+    using ::operator<<;
+    const std::unordered_set<std::string> valid_tensors{
+        db::tag_name<Tensors>()...};
+    for (const auto& name : variables_to_observe_) {
+      if (valid_tensors.count(name) != 1) {
+        PARSE_ERROR(
+            context,
+            name << " is not an available variable.  Available variables:\n"
+                 << (std::vector<std::string>{db::tag_name<Tensors>()...}));
+      }
+      if (alg::count(variables_to_observe, name) != 1) {
+        PARSE_ERROR(context, name << " specified multiple times");
+      }
+    }
+    variables_to_observe_.insert(coordinates_tag::name());
+  }
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, domain::Tags::Mesh<VolumeDim>,
+                 domain::Tags::Element<VolumeDim>, coordinates_tag,
+                 Tensors...>;
+
+  template <typename Metavariables, typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const Mesh<VolumeDim>& mesh,
+                  const Element<VolumeDim>& element,
+                  const tnsr::I<DataVector, VolumeDim, Frame::Inertial>&
+                      inertial_coordinates,
+                  const typename Tensors::type&... tensors,
+                  Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ElementId<VolumeDim>& array_index,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    std::vector<TensorComponent> components{};
+    Index<VolumeDim> slice_extents = mesh.extents();
+
+    const auto slice = ObserveFieldsOnSlice_detail::logical_slice(
+        mesh, inertial_coordinates.get(slice_dimension_), slice_coordinate_,
+        element.external_boundaries());
+    if (slice.has_value()) {
+      const size_t logical_dim = slice->first;
+      slice_extents[logical_dim] = 1;
+      auto target_logical_coords = make_array<VolumeDim>(DataVector{});
+      gsl::at(target_logical_coords, logical_dim) = DataVector{slice->second};
+      const intrp::RegularGrid<VolumeDim> interpolant(mesh, mesh,
+                                                      target_logical_coords);
+
+      const std::string element_name =
+          MakeString{} << ElementId<VolumeDim>(array_index) << '/';
+      const auto record_tensor_components =
+          [this, &components, &element_name, &interpolant](
+              const auto tensor_tag_v, const auto& tensor) noexcept {
+            using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+            if (variables_to_observe_.count(db::tag_name<tensor_tag>()) ==
+                1) {
+              for (size_t i = 0; i < tensor.size(); ++i) {
+                components.emplace_back(element_name +
+                                            db::tag_name<tensor_tag>() +
+                                            tensor.component_suffix(i),
+                                        interpolant.interpolate(tensor[i]));
+              }
+            }
+          };
+      record_tensor_components(tmpl::type_<coordinates_tag>{},
+                               inertial_coordinates);
+      EXPAND_PACK_LEFT_TO_RIGHT(
+          record_tensor_components(tmpl::type_<Tensors>{}, tensors));
+    }
+
+    // Every registered element must contribute to the observation, so
+    // elements the slice doesn't intersect send no components, which the
+    // writer skips.
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeVolumeData>(
+        local_observer,
+        observers::ObservationId(
+            observation_value,
+            typename Metavariables::element_observation_type{}),
+        subfile_path_,
+        observers::ArrayComponentId(
+            std::add_pointer_t<ParallelComponent>{nullptr},
+            Parallel::ArrayIndex<ElementId<VolumeDim>>(array_index)),
+        std::move(components), slice_extents);
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept override {
+    Event<EventRegistrars>::pup(p);
+    p | subfile_path_;
+    p | variables_to_observe_;
+    p | slice_dimension_;
+    p | slice_coordinate_;
+  }
+
+ private:
+  std::string subfile_path_{};
+  std::unordered_set<std::string> variables_to_observe_{};
+  size_t slice_dimension_{0};
+  double slice_coordinate_{0.0};
+};
+
+/// \cond
+template <size_t VolumeDim, typename ObservationValueTag, typename... Tensors,
+          typename EventRegistrars>
+PUP::able::PUP_ID
+    ObserveFieldsOnSlice<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
+                         EventRegistrars>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
+}  // namespace dg
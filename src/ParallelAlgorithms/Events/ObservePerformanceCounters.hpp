@@ -0,0 +1,189 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"   // IWYU pragma: keep
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/PerformanceCounters.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace dg {
+namespace Events {
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars>
+class ObservePerformanceCounters;
+
+namespace Registrars {
+template <size_t VolumeDim, typename ObservationValueTag>
+// Presence of size_t template argument requires to define this struct
+// instead of using Registration::Registrar alias.
+struct ObservePerformanceCounters {
+  template <typename RegistrarList>
+  using f = Events::ObservePerformanceCounters<VolumeDim, ObservationValueTag,
+                                               RegistrarList>;
+};
+}  // namespace Registrars
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief %Observe the distribution of the `Parallel::PerformanceCounters` over
+ * the elements.
+ *
+ * Writes reduction quantities:
+ * - `ObservationValueTag`
+ * - `NumberOfElements` = total number of elements in the domain
+ * - `NumberOfPoints` = total number of points in the domain
+ * - `WallTime` = the wall time in seconds when the last element was observed
+ * - For each counter `X` (see `Parallel::PerformanceCounter`), the smallest,
+ *   largest and mean count over the elements, `Min(X)`, `Max(X)` and
+ *   `Mean(X)`
+ *
+ * The counts are accumulated from the start of the run, so the work done
+ * between two observations, and its rate, is the difference of the counts
+ * (and of the `WallTime`). The cadence of the observations is controlled by
+ * the trigger of the event.
+ *
+ * \warning Currently, only one reduction observation event can be
+ * triggered at a given observation value.  Causing multiple events to run at
+ * once will produce unpredictable results.
+ */
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars =
+              tmpl::list<Registrars::ObservePerformanceCounters<
+                  VolumeDim, ObservationValueTag>>>
+class ObservePerformanceCounters : public Event<EventRegistrars> {
+ private:
+  static constexpr size_t number_of_counters =
+      Parallel::PerformanceCounters::number_of_counters;
+
+  using MeanDatum = Parallel::ReductionDatum<double, funcl::Plus<>,
+                                             funcl::Divides<>,
+                                             std::index_sequence<1>>;
+  using ReductionData = tmpl::wrap<
+      tmpl::append<
+          tmpl::list<Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+                     Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+                     Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+                     Parallel::ReductionDatum<double, funcl::Max<>>>,
+          tmpl::flatten<tmpl::filled_list<
+              tmpl::list<Parallel::ReductionDatum<double, funcl::Min<>>,
+                         Parallel::ReductionDatum<double, funcl::Max<>>,
+                         MeanDatum>,
+              number_of_counters>>>,
+      Parallel::ReductionData>;
+
+ public:
+  /// \cond
+  explicit ObservePerformanceCounters(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObservePerformanceCounters);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help =
+      "Observe the distribution of the performance counters over the\n"
+      "elements.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " * ObservationValueTag\n"
+      " * NumberOfElements = total number of elements in the domain\n"
+      " * NumberOfPoints = total number of points in the domain\n"
+      " * WallTime = wall time in seconds\n"
+      " * Min(*), Max(*), Mean(*) = distribution of each counter over the\n"
+      "   elements, accumulated from the start of the run\n"
+      "\n"
+      "Warning: Currently, only one reduction observation event can be\n"
+      "triggered at a given observation value.  Causing multiple events to\n"
+      "run at once will produce unpredictable results.";
+
+  ObservePerformanceCounters() = default;
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, domain::Tags::Mesh<VolumeDim>,
+                 Parallel::Tags::PerformanceCounters>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const Mesh<VolumeDim>& mesh,
+                  const Parallel::PerformanceCounters& counters,
+                  Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    std::vector<std::string> reduction_names{
+        db::tag_name<ObservationValueTag>(), "NumberOfElements",
+        "NumberOfPoints", "WallTime"};
+    for (const auto counter : Parallel::PerformanceCounters::all_counters) {
+      std::ostringstream counter_name{};
+      counter_name << counter;
+      reduction_names.push_back("Min(" + counter_name.str() + ")");
+      reduction_names.push_back("Max(" + counter_name.str() + ")");
+      reduction_names.push_back("Mean(" + counter_name.str() + ")");
+    }
+
+    // Send data to reduction observer
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(
+            observation_value,
+            typename Metavariables::element_observation_type{}),
+        std::string{"/performance_counters"}, std::move(reduction_names),
+        make_reduction_data(
+            static_cast<double>(observation_value),
+            mesh.number_of_grid_points(), counters,
+            std::make_index_sequence<3 * number_of_counters>{}));
+  }
+
+ private:
+  // Each counter fills its minimum, maximum and mean
+  template <size_t... Is>
+  static ReductionData make_reduction_data(
+      const double observation_value, const size_t number_of_points,
+      const Parallel::PerformanceCounters& counters,
+      std::index_sequence<Is...> /*meta*/) noexcept {
+    return ReductionData{
+        observation_value, 1_st, number_of_points, Parallel::wall_time(),
+        static_cast<double>(counters[gsl::at(
+            Parallel::PerformanceCounters::all_counters, Is / 3)])...};
+  }
+};
+
+/// \cond
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars>
+PUP::able::PUP_ID
+    ObservePerformanceCounters<VolumeDim, ObservationValueTag,
+                               EventRegistrars>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
+}  // namespace dg
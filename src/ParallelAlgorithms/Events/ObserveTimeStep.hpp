@@ -0,0 +1,160 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"   // IWYU pragma: keep
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace dg {
+namespace Events {
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars>
+class ObserveTimeStep;
+
+namespace Registrars {
+template <size_t VolumeDim, typename ObservationValueTag>
+// Presence of size_t template argument requires to define this struct
+// instead of using Registration::Registrar alias.
+struct ObserveTimeStep {
+  template <typename RegistrarList>
+  using f = Events::ObserveTimeStep<VolumeDim, ObservationValueTag,
+                                    RegistrarList>;
+};
+}  // namespace Registrars
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief %Observe the distribution of time step sizes over the elements.
+ *
+ * Writes reduction quantities:
+ * - `ObservationValueTag`
+ * - `NumberOfPoints` = total number of points in the domain
+ * - `SlabSize` = the size of the current slab
+ * - `MinimumTimeStep` = smallest step size of any element
+ * - `MaximumTimeStep` = largest step size of any element
+ * - `EffectiveTimeStep` = the step size that a global time-stepping
+ *   evolution would have to take to perform the same number of point
+ *   updates per unit time, i.e. \f$N / \sum_e (N_e / \Delta t_e)\f$ where
+ *   \f$N_e\f$ is the number of points in element \f$e\f$ and \f$N = \sum_e
+ *   N_e\f$.
+ *
+ * With local time-stepping the ratio of `EffectiveTimeStep` to
+ * `MinimumTimeStep` is the speedup over a global time step limited by the
+ * most restrictive element.
+ *
+ * \warning Currently, only one reduction observation event can be
+ * triggered at a given observation value.  Causing multiple events to run at
+ * once will produce unpredictable results.
+ */
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars = tmpl::list<
+              Registrars::ObserveTimeStep<VolumeDim, ObservationValueTag>>>
+class ObserveTimeStep : public Event<EventRegistrars> {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<double, funcl::Min<>>,
+      Parallel::ReductionDatum<double, funcl::Max<>>,
+      Parallel::ReductionDatum<double, funcl::Plus<>,
+                               funcl::Divides<funcl::Literal<1, double>,
+                                              funcl::Divides<>>,
+                               std::index_sequence<1>>>;
+
+ public:
+  /// \cond
+  explicit ObserveTimeStep(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveTimeStep);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help =
+      "Observe the distribution of time step sizes over the elements.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " * ObservationValueTag\n"
+      " * NumberOfPoints = total number of points in the domain\n"
+      " * SlabSize = the size of the current slab\n"
+      " * MinimumTimeStep = smallest step size of any element\n"
+      " * MaximumTimeStep = largest step size of any element\n"
+      " * EffectiveTimeStep = global step size with the same cost\n"
+      "\n"
+      "Warning: Currently, only one reduction observation event can be\n"
+      "triggered at a given observation value.  Causing multiple events to\n"
+      "run at once will produce unpredictable results.";
+
+  ObserveTimeStep() = default;
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using argument_tags = tmpl::list<ObservationValueTag, ::Tags::TimeStep,
+                                   domain::Tags::Mesh<VolumeDim>>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const TimeDelta& time_step, const Mesh<VolumeDim>& mesh,
+                  Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    const size_t number_of_points = mesh.number_of_grid_points();
+    const double slab_size = time_step.slab().duration().value();
+    const double step_size = std::abs(time_step.value());
+
+    // Send data to reduction observer
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(
+            observation_value,
+            typename Metavariables::element_observation_type{}),
+        std::string{"/time_steps"},
+        std::vector<std::string>{db::tag_name<ObservationValueTag>(),
+                                 "NumberOfPoints", "SlabSize",
+                                 "MinimumTimeStep", "MaximumTimeStep",
+                                 "EffectiveTimeStep"},
+        ReductionData{static_cast<double>(observation_value), number_of_points,
+                      slab_size, step_size, step_size,
+                      static_cast<double>(number_of_points) / step_size});
+  }
+};
+
+/// \cond
+template <size_t VolumeDim, typename ObservationValueTag,
+          typename EventRegistrars>
+PUP::able::PUP_ID
+    ObserveTimeStep<VolumeDim, ObservationValueTag,
+                    EventRegistrars>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
+}  // namespace dg
@@ -0,0 +1,55 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/PerformanceCounters.hpp"
+#include "ParallelAlgorithms/Initialization/MergeIntoDataBox.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class ConstGlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace Initialization {
+namespace Actions {
+/*!
+ * \ingroup ActionsGroup
+ *
+ * \brief Add zeroed performance counters to the DataBox, so the actions that
+ * do the work of the element start counting it.
+ *
+ * Uses: nothing
+ *
+ * DataBox changes:
+ * - Adds:
+ *   - `Parallel::Tags::PerformanceCounters`
+ * - Removes:
+ *   - nothing
+ * - Modifies:
+ *   - nothing
+ */
+struct PerformanceCounters {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/, ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    using simple_tags = db::AddSimpleTags<Parallel::Tags::PerformanceCounters>;
+    return std::make_tuple(
+        merge_into_databox<PerformanceCounters, simple_tags>(
+            std::move(box), Parallel::PerformanceCounters{}));
+  }
+};
+}  // namespace Actions
+}  // namespace Initialization
@@ -233,6 +233,7 @@ class KerrSchild : public MarkAsAnalyticSolution {
   };
   using options = tmpl::list<Mass, Spin, Center>;
   static constexpr OptionString help{"Black hole in Kerr-Schild coordinates"};
+  static constexpr bool is_time_independent = true;
 
   KerrSchild(double mass, Spin::type dimensionless_spin, Center::type center,
              const OptionContext& context = {});
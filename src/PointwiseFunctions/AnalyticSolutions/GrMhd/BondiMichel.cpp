@@ -6,10 +6,12 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/RootFinding/Brent.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/Hydro/Tags.hpp"
@@ -111,28 +113,40 @@ BondiMichel::IntermediateVars<DataType>::IntermediateVars(
           in_bernoulli_constant_squared_minus_one),
       sonic_radius(in_sonic_radius),
       sonic_density(in_sonic_density) {
-  // NOLINTNEXTLINE(clang-analyzer-core)
-  for (size_t i = 0; i < get_size(rest_mass_density); i++) {
-    const double current_radius = get_element(radius, i);
-    // Near the sonic radius, a second root to the Bernoulli
-    // root function appears. Within the sonic radius, the
-    // upper bound of
-    // `mass_accretion_rate_over_four_pi_ * sqrt(2.0 /
-    // (mass_* cube(current_radius)))` selects the correct one
-    // of two possible roots. Beyond the sonic radius, this
-    // becomes the lower bound provided to the root finder.
-    const double sonic_bound = mass_accretion_rate_over_four_pi *
-                               sqrt(2.0 / (mass * cube(current_radius)));
-    get_element(rest_mass_density, i) =
-        // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(
-            [&current_radius, this ](const double guess_for_rho) noexcept {
-              return bernoulli_root_function(guess_for_rho, current_radius);
-            },
-            current_radius < sonic_radius ? rest_mass_density_at_infinity
-                                          : sonic_bound,
-            current_radius < sonic_radius ? sonic_bound : sonic_density, 1.e-15,
-            1.e-15);
+  // Near the sonic radius, a second root to the Bernoulli
+  // root function appears. Within the sonic radius, the
+  // upper bound of
+  // `mass_accretion_rate_over_four_pi_ * sqrt(2.0 /
+  // (mass_* cube(current_radius)))` selects the correct one
+  // of two possible roots. Beyond the sonic radius, this
+  // becomes the lower bound provided to the root finder.
+  if constexpr (std::is_same_v<DataType, double>) {
+    const double sonic_bound =
+        mass_accretion_rate_over_four_pi * sqrt(2.0 / (mass * cube(radius)));
+    // NOLINTNEXTLINE(clang-analyzer-core)
+    rest_mass_density = RootFinder::toms748(
+        [this](const double guess_for_rho) noexcept {
+          return bernoulli_root_function(guess_for_rho, radius);
+        },
+        radius < sonic_radius ? rest_mass_density_at_infinity : sonic_bound,
+        radius < sonic_radius ? sonic_bound : sonic_density, 1.e-15, 1.e-15);
+  } else {
+    // Solve at all points together so the root function is evaluated with
+    // vectorized DataVector operations.
+    DataVector lower_bound{radius.size()};
+    DataVector upper_bound{radius.size()};
+    for (size_t i = 0; i < radius.size(); i++) {
+      const double sonic_bound = mass_accretion_rate_over_four_pi *
+                                 sqrt(2.0 / (mass * cube(radius[i])));
+      lower_bound[i] = radius[i] < sonic_radius ? rest_mass_density_at_infinity
+                                                : sonic_bound;
+      upper_bound[i] = radius[i] < sonic_radius ? sonic_bound : sonic_density;
+    }
+    rest_mass_density = RootFinder::lockstep_brent(
+        [this](const DataVector& guess_for_rho) noexcept {
+          return bernoulli_root_function(guess_for_rho, radius);
+        },
+        lower_bound, upper_bound, 1.e-15, 1.e-15);
   }
   if (need_spacetime) {
     kerr_schild_soln = background_spacetime.variables(
@@ -141,18 +155,18 @@ BondiMichel::IntermediateVars<DataType>::IntermediateVars(
 }
 
 template <typename DataType>
-double BondiMichel::IntermediateVars<DataType>::bernoulli_root_function(
-    const double rest_mass_density_guess, const double current_radius) const
-    noexcept {
+DataType BondiMichel::IntermediateVars<DataType>::bernoulli_root_function(
+    const DataType& rest_mass_density_guess,
+    const DataType& current_radius) const noexcept {
   const double gamma_minus_one = polytropic_exponent - 1.0;
-  const double polytropic_index_times_newtonian_sound_speed_squared =
+  const DataType polytropic_index_times_newtonian_sound_speed_squared =
       (polytropic_exponent * polytropic_constant *
        pow(rest_mass_density_guess, gamma_minus_one)) /
       gamma_minus_one;
-  const double specific_enthalpy_squared_minus_one =
+  const DataType specific_enthalpy_squared_minus_one =
       polytropic_index_times_newtonian_sound_speed_squared *
       (2.0 + polytropic_index_times_newtonian_sound_speed_squared);
-  const double specific_enthalpy_squared =
+  const DataType specific_enthalpy_squared =
       specific_enthalpy_squared_minus_one + 1.0;
   // As the bernoulli constant is 1.0 + a small number, it is better numerically
   // to compute it as (small_number_1) + (1.0 + small_number_1) * small_number_2
@@ -213,6 +213,7 @@ class BondiMichel : public MarkAsAnalyticSolution {
       "the Schwarzschild coordinate system. Quantities prefixed with \n"
       "`sonic` refer to field quantities evaluated at the radius \n"
       "where the fluid speed overtakes the sound speed."};
+  static constexpr bool is_time_independent = true;
 
   BondiMichel() = default;
   BondiMichel(const BondiMichel& /*rhs*/) = delete;
@@ -354,8 +355,9 @@ class BondiMichel : public MarkAsAnalyticSolution {
     double bernoulli_constant_squared_minus_one{};
     double sonic_radius{};
     double sonic_density{};
-    double bernoulli_root_function(double rest_mass_density_guess,
-                                   double current_radius) const noexcept;
+    DataType bernoulli_root_function(const DataType& rest_mass_density_guess,
+                                     const DataType& current_radius) const
+        noexcept;
     tuples::tagged_tuple_from_typelist<
         typename gr::Solutions::KerrSchild::tags<DataType>>
         kerr_schild_soln{};
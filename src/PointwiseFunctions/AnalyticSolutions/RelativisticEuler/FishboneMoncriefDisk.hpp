@@ -200,6 +200,7 @@ class FishboneMoncriefDisk : public MarkAsAnalyticSolution {
                  PolytropicConstant, PolytropicExponent>;
   static constexpr OptionString help = {
       "Fluid disk orbiting a Kerr black hole."};
+  static constexpr bool is_time_independent = true;
 
   FishboneMoncriefDisk() = default;
   FishboneMoncriefDisk(const FishboneMoncriefDisk& /*rhs*/) = delete;
@@ -140,6 +140,7 @@ class TovStar : public MarkAsAnalyticSolution {
       "A static, spherically-symmetric star found by solving the \n"
       "Tolman-Oppenheimer-Volkoff (TOV) equations, with a given central \n"
       "density and polytropic fluid."};
+  static constexpr bool is_time_independent = true;
 
   TovStar() = default;
   TovStar(const TovStar& /*rhs*/) = delete;
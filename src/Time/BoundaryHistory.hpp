@@ -3,17 +3,17 @@
 
 #pragma once
 
-#include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
+#include <limits>
 #include <map>
 #include <pup.h>
 #include <pup_stl.h>  // IWYU pragma: keep
 #include <tuple>
 #include <utility>
 
-#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep
 #include "Time/Time.hpp"  // IWYU pragma: keep
@@ -38,13 +38,10 @@ class BoundaryHistory {
   using local_iterator = IteratorType<LocalVars>;
   using remote_iterator = IteratorType<RemoteVars>;
 
-  // No copying because of the pointers in the cache.  Moving is fine
-  // because we also move the container being pointed into and maps
-  // guarantee that this doesn't invalidate pointers.
   BoundaryHistory() = default;
-  BoundaryHistory(const BoundaryHistory&) = delete;
+  BoundaryHistory(const BoundaryHistory&) = default;
   BoundaryHistory(BoundaryHistory&&) = default;
-  BoundaryHistory& operator=(const BoundaryHistory&) = delete;
+  BoundaryHistory& operator=(const BoundaryHistory&) = default;
   BoundaryHistory& operator=(BoundaryHistory&&) = default;
   ~BoundaryHistory() = default;
 
@@ -64,10 +61,12 @@ class BoundaryHistory {
   void local_insert_initial(const TimeStepId& time_id,
                             LocalVars vars) noexcept {
     local_data_.emplace_front(time_id.substep_time(), std::move(vars));
+    --local_offset_;
   }
   void remote_insert_initial(const TimeStepId& time_id,
                              RemoteVars vars) noexcept {
     remote_data_.emplace_front(time_id.substep_time(), std::move(vars));
+    --remote_offset_;
   }
   //@}
 
@@ -76,12 +75,8 @@ class BoundaryHistory {
   /// directly should not often be necessary, as it is handled
   /// internally by the time steppers.
   //@{
-  void local_mark_unneeded(const local_iterator& first_needed) noexcept {
-    mark_unneeded<0>(make_not_null(&local_data_), first_needed);
-  }
-  void remote_mark_unneeded(const remote_iterator& first_needed) noexcept {
-    mark_unneeded<1>(make_not_null(&remote_data_), first_needed);
-  }
+  void local_mark_unneeded(const local_iterator& first_needed) noexcept;
+  void remote_mark_unneeded(const remote_iterator& first_needed) noexcept;
   //@}
 
   /// Access to the sequence of times on the indicated side.
@@ -131,35 +126,54 @@ class BoundaryHistory {
   void pup(PUP::er& p) noexcept;  // NOLINT
 
  private:
-  template <size_t Side, typename DataType, typename Iterator>
-  void mark_unneeded(gsl::not_null<DataType*> data,
-                     const Iterator& first_needed) noexcept;
+  // Entries are identified in the coupling cache by their position in the
+  // sequence of all entries ever inserted on their side, so the keys are
+  // unaffected by insertions and removals of other entries and can be
+  // serialized directly.  The offsets are the identifiers of the first
+  // entries currently stored.
+  using EntryId = std::int64_t;
 
   std::deque<std::tuple<Time, LocalVars>> local_data_;
   std::deque<std::tuple<Time, RemoteVars>> remote_data_;
-  // We use pointers instead of iterators because deque invalidates
-  // iterators when elements are inserted or removed at the ends, but
-  // not pointers.
-  mutable std::map<std::pair<const Time*, const Time*>, CouplingResult>
+  EntryId local_offset_ = 0;
+  EntryId remote_offset_ = 0;
+  // Ordered by local entry first, so the entries for removed local data
+  // are always at the start of the map.
+  mutable std::map<std::pair<EntryId, EntryId>, CouplingResult>
       coupling_cache_;
 };
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
-template <size_t Side, typename DataType, typename Iterator>
-void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::mark_unneeded(
-    gsl::not_null<DataType*> data, const Iterator& first_needed) noexcept {
-  for (auto it = data->begin(); it != first_needed.base(); ++it) {
-    // Clean out cache entries referring to the entry we are removing.
-    for (auto cache_entry = coupling_cache_.begin();
-         cache_entry != coupling_cache_.end();) {
-      if (std::get<Side>(cache_entry->first) == &std::get<0>(*it)) {
-        cache_entry = coupling_cache_.erase(cache_entry);
-      } else {
-        ++cache_entry;
-      }
+void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::
+    local_mark_unneeded(const local_iterator& first_needed) noexcept {
+  const auto entries_to_remove = first_needed.base() - local_data_.cbegin();
+  local_offset_ += entries_to_remove;
+  // Clean out cache entries referring to the entries we are removing.
+  coupling_cache_.erase(
+      coupling_cache_.begin(),
+      coupling_cache_.lower_bound(std::make_pair(
+          local_offset_, std::numeric_limits<EntryId>::lowest())));
+  local_data_.erase(local_data_.begin(), first_needed.base());
+}
+
+template <typename LocalVars, typename RemoteVars, typename CouplingResult>
+void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::
+    remote_mark_unneeded(const remote_iterator& first_needed) noexcept {
+  const auto entries_to_remove = first_needed.base() - remote_data_.cbegin();
+  if (entries_to_remove == 0) {
+    return;
+  }
+  remote_offset_ += entries_to_remove;
+  // Clean out cache entries referring to the entries we are removing.
+  for (auto cache_entry = coupling_cache_.begin();
+       cache_entry != coupling_cache_.end();) {
+    if (cache_entry->first.second < remote_offset_) {
+      cache_entry = coupling_cache_.erase(cache_entry);
+    } else {
+      ++cache_entry;
     }
   }
-  data->erase(data->begin(), first_needed.base());
+  remote_data_.erase(remote_data_.begin(), first_needed.base());
 }
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
@@ -168,8 +182,10 @@ const CouplingResult&
 BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::coupling(
     Coupling&& c, const local_iterator& local,
     const remote_iterator& remote) const noexcept {
-  const auto insert_result = coupling_cache_.insert(
-      std::make_pair(std::make_pair(&*local, &*remote), CouplingResult{}));
+  const auto insert_result = coupling_cache_.insert(std::make_pair(
+      std::make_pair(local_offset_ + (local.base() - local_data_.begin()),
+                     remote_offset_ + (remote.base() - remote_data_.begin())),
+      CouplingResult{}));
   CouplingResult& inserted_value = insert_result.first->second;
   const bool is_new_value = insert_result.second;
   if (is_new_value) {
@@ -185,53 +201,8 @@ void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::pup(
     PUP::er& p) noexcept {
   p | local_data_;
   p | remote_data_;
-
-  const size_t cache_size = PUP_stl_container_size(p, coupling_cache_);
-  if (p.isUnpacking()) {
-    for (size_t entry_num = 0; entry_num < cache_size; ++entry_num) {
-      size_t local_index = 0;
-      size_t remote_index = 0;
-      CouplingResult cache_value;
-      p | local_index;
-      p | remote_index;
-      p | cache_value;
-      const auto cache_key =
-          std::make_pair(&std::get<0>(local_data_[local_index]),
-                         &std::get<0>(remote_data_[remote_index]));
-      coupling_cache_.insert(std::make_pair(cache_key, cache_value));
-    }
-  } else {
-    for (auto& cache_entry : coupling_cache_) {
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t local_index = static_cast<size_t>(  // NOLINT
-          std::find_if(
-              local_data_.begin(), local_data_.end(),
-              [goal = cache_entry.first.first](const auto& entry) noexcept {
-                return &std::get<0>(entry) == goal;
-              }) -
-          local_data_.begin());
-      ASSERT(local_index < local_data_.size(),
-             "Failed to find local history entry for cache entry");
-
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t remote_index = static_cast<size_t>(  // NOLINT
-          std::find_if(
-              remote_data_.begin(), remote_data_.end(),
-              [goal = cache_entry.first.second](const auto& entry) noexcept {
-                return &std::get<0>(entry) == goal;
-              }) -
-          remote_data_.begin());
-      ASSERT(remote_index < remote_data_.size(),
-             "Failed to find remote history entry for cache entry");
-
-      p | local_index;
-      p | remote_index;
-      p | cache_entry.second;
-    }
-  }
+  p | local_offset_;
+  p | remote_offset_;
+  p | coupling_cache_;
 }
 }  // namespace TimeSteppers
@@ -3,13 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-#include <deque>
 #include <iterator>
 #include <tuple>
 #include <utility>
+#include <vector>
 
-#include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep  // p | deque, tuple
+#include "ErrorHandling/Assert.hpp"
+#include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep  // p | vector, tuple
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 
@@ -28,6 +30,10 @@ class HistoryIterator;
 
 /// \ingroup TimeSteppersGroup
 /// History data used by a TimeStepper.
+///
+/// The entries are stored in a ring buffer, so entries marked as unneeded
+/// are reused for new entries without moving or reallocating the stored
+/// variables.
 /// \tparam Vars type of variables being integrated
 /// \tparam DerivVars type of derivative variables
 template <typename Vars, typename DerivVars>
@@ -61,16 +67,28 @@ class History {
   /// necessary, as it is handled internally by the time steppers.
   void mark_unneeded(const const_iterator& first_needed) noexcept;
 
+  /// Mark the values (but not the derivatives) of all data before the
+  /// passed point in history as unneeded, so their memory can be
+  /// released.  Time steppers that only use the derivatives of past
+  /// steps, such as Adams-Bashforth methods, call this to reduce the
+  /// memory used by the history.  The values of these entries must not
+  /// be accessed afterwards.
+  ///
+  /// One released value is kept to be reused by the next inserted
+  /// entry, so releasing values does not cause an allocation each
+  /// step.
+  void mark_values_unneeded(const const_iterator& first_needed) noexcept;
+
   /// These iterators directly return the Time of the past values.
   /// The other data can be accessed through the iterators using
   /// HistoryIterator::value() and HistoryIterator::derivative().
   //@{
   const_iterator begin() const noexcept {
-    return data_.begin() +
-           static_cast<typename decltype(data_.begin())::difference_type>(
-               first_needed_entry_);
+    return {&data_, start_, first_needed_entry_};
+  }
+  const_iterator end() const noexcept {
+    return {&data_, start_, data_.size()};
   }
-  const_iterator end() const noexcept { return data_.end(); }
   const_iterator cbegin() const noexcept { return begin(); }
   const_iterator cend() const noexcept { return end(); }
   //@}
@@ -87,9 +105,7 @@ class History {
   }
 
   const_reference front() const noexcept { return *begin(); }
-  const_reference back() const noexcept {
-    return std::get<0>(data_.back()).substep_time();
-  }
+  const_reference back() const noexcept { return *(end() - 1); }
   //@}
 
   // clang-tidy: google-runtime-references
@@ -99,11 +115,24 @@ class History {
     // route of just throwing them away.
     shrink_to_fit();
     p | data_;
+    p | first_value_entry_;
   }
 
  private:
-  std::deque<std::tuple<TimeStepId, Vars, DerivVars>> data_;
+  // Moves the oldest entry to the front of the storage, so the ring
+  // buffer can be resized.
+  void linearize() noexcept;
+
+  // Entry `n` (counting from the oldest, including unneeded entries) is
+  // stored at `data_[(start_ + n) % data_.size()]`.
+  std::vector<std::tuple<TimeStepId, Vars, DerivVars>> data_;
+  size_t start_{0};
   size_t first_needed_entry_{0};
+  // The entries before this one hold no values
+  size_t first_value_entry_{0};
+  // A released value whose memory is reused by the next new entry
+  Vars spare_value_{};
+  bool has_spare_value_{false};
 };
 
 /// \ingroup TimeSteppersGroup
@@ -111,59 +140,67 @@ class History {
 /// details.
 template <typename Vars, typename DerivVars>
 class HistoryIterator {
-  using Base = typename std::deque<
-      std::tuple<TimeStepId, Vars, DerivVars>>::const_iterator;
+  using Storage = std::vector<std::tuple<TimeStepId, Vars, DerivVars>>;
 
  public:
-  using iterator_category =
-      typename std::iterator_traits<Base>::iterator_category;
+  using iterator_category = std::random_access_iterator_tag;
   using value_type = Time;
-  using difference_type = typename std::iterator_traits<Base>::difference_type;
+  using difference_type = std::ptrdiff_t;
   using pointer = const value_type*;
   using reference = const value_type&;
 
   HistoryIterator() = default;
 
   reference operator*() const noexcept {
-    return std::get<0>(*base_).substep_time();
+    return std::get<0>(entry(0)).substep_time();
   }
   pointer operator->() const noexcept { return &**this; }
   reference operator[](const difference_type n) const noexcept {
-    return std::get<0>(base_[n]).substep_time();
+    return std::get<0>(entry(n)).substep_time();
   }
-  HistoryIterator& operator++() noexcept { ++base_; return *this; }
+  HistoryIterator& operator++() noexcept { ++index_; return *this; }
   // clang-tidy: return const... Really? What?
-  HistoryIterator operator++(int) noexcept { return base_++; }  // NOLINT
-  HistoryIterator& operator--() noexcept { --base_; return *this; }
+  HistoryIterator operator++(int) noexcept {  // NOLINT
+    auto result = *this;
+    ++index_;
+    return result;
+  }
+  HistoryIterator& operator--() noexcept { --index_; return *this; }
   // clang-tidy: return const... Really? What?
-  HistoryIterator operator--(int) noexcept { return base_--; }  // NOLINT
+  HistoryIterator operator--(int) noexcept {  // NOLINT
+    auto result = *this;
+    --index_;
+    return result;
+  }
   HistoryIterator& operator+=(difference_type n) noexcept {
-    base_ += n;
+    index_ = static_cast<size_t>(static_cast<difference_type>(index_) + n);
     return *this;
   }
   HistoryIterator& operator-=(difference_type n) noexcept {
-    base_ -= n;
-    return *this;
+    return *this += -n;
   }
 
   const TimeStepId& time_step_id() const noexcept {
-    return std::get<0>(*base_);
+    return std::get<0>(entry(0));
+  }
+  const Vars& value() const noexcept { return std::get<1>(entry(0)); }
+  const DerivVars& derivative() const noexcept {
+    return std::get<2>(entry(0));
   }
-  const Vars& value() const noexcept { return std::get<1>(*base_); }
-  const DerivVars& derivative() const noexcept { return std::get<2>(*base_); }
 
  private:
   friend class History<Vars, DerivVars>;
 
   friend difference_type operator-(const HistoryIterator& a,
                                    const HistoryIterator& b) noexcept {
-    return a.base_ - b.base_;
+    return static_cast<difference_type>(a.index_) -
+           static_cast<difference_type>(b.index_);
   }
 
 #define FORWARD_HISTORY_ITERATOR_OP(op)                        \
   friend bool operator op(const HistoryIterator& a,            \
                           const HistoryIterator& b) noexcept { \
-    return a.base_ op b.base_;                                 \
+    return a.index_ op b.index_;                               \
   }
   FORWARD_HISTORY_ITERATOR_OP(==)
   FORWARD_HISTORY_ITERATOR_OP(!=)
@@ -173,10 +210,23 @@ class HistoryIterator {
   FORWARD_HISTORY_ITERATOR_OP(>=)
 #undef FORWARD_HISTORY_ITERATOR_OP
 
-  // clang-tidy: google-explicit-constructor - private
-  HistoryIterator(Base base) noexcept : base_(std::move(base)) {}  // NOLINT
+  HistoryIterator(const Storage* const data, const size_t start,
+                  const size_t index) noexcept
+      : data_(data), start_(start), index_(index) {}
 
-  Base base_{};
+  const std::tuple<TimeStepId, Vars, DerivVars>& entry(
+      const difference_type offset) const noexcept {
+    const auto n = static_cast<size_t>(static_cast<difference_type>(index_) +
+                                       offset);
+    ASSERT(n < data_->size(), "Iterator out of range: " << n);
+    return (*data_)[(start_ + n) % data_->size()];
+  }
+
+  const Storage* data_{nullptr};
+  // The position of the oldest entry in `data_`
+  size_t start_{0};
+  // The entry pointed to, counting from the oldest entry
+  size_t index_{0};
 };
 
 // ================================================================
@@ -186,17 +236,24 @@ void History<Vars, DerivVars>::insert(const TimeStepId& time_step_id,
                                       const Vars& value,
                                       const DerivVars& deriv) noexcept {
   if (first_needed_entry_ == 0) {
+    linearize();
     data_.emplace_back(time_step_id, value, deriv);
   } else {
-    // Reuse resources from an old entry.
-    auto& old_entry = data_.front();
-    // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+    // Reuse resources from the oldest entry, which becomes the newest
+    // entry.
+    auto& old_entry = data_[start_];
+    if (first_value_entry_ > 0 and has_spare_value_) {
+      std::get<1>(old_entry) = std::move(spare_value_);
+      has_spare_value_ = false;
+    }
     std::get<0>(old_entry) = time_step_id;
     std::get<1>(old_entry) = value;
     std::get<2>(old_entry) = deriv;
-    data_.push_back(std::move(old_entry));
-    data_.pop_front();
+    start_ = (start_ + 1) % data_.size();
     --first_needed_entry_;
+    if (first_value_entry_ > 0) {
+      --first_value_entry_;
+    }
   }
 }
 
@@ -204,25 +261,58 @@ template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::insert_initial(TimeStepId time_step_id,
                                                      Vars value,
                                                      DerivVars deriv) noexcept {
+  ASSERT(first_value_entry_ == 0,
+         "Cannot insert initial data before entries without values.");
+  linearize();
   // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
-  data_.emplace_front(std::move(time_step_id), std::move(value),
-                      std::move(deriv));
+  data_.emplace(data_.begin(), std::move(time_step_id), std::move(value),
+                std::move(deriv));
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::mark_unneeded(
     const const_iterator& first_needed) noexcept {
-  first_needed_entry_ = static_cast<size_t>(first_needed.base_ - data_.begin());
+  first_needed_entry_ = first_needed.index_;
+}
+
+template <typename Vars, typename DerivVars>
+inline void History<Vars, DerivVars>::mark_values_unneeded(
+    const const_iterator& first_needed) noexcept {
+  for (; first_value_entry_ < first_needed.index_; ++first_value_entry_) {
+    auto& value =
+        std::get<1>(data_[(start_ + first_value_entry_) % data_.size()]);
+    if (has_spare_value_) {
+      value = Vars{};
+    } else {
+      spare_value_ = std::move(value);
+      has_spare_value_ = true;
+    }
+  }
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::shrink_to_fit() noexcept {
+  linearize();
   data_.erase(
       data_.begin(),
       data_.begin() +
           static_cast<typename decltype(data_.begin())::difference_type>(
               first_needed_entry_));
+  first_value_entry_ -= std::min(first_value_entry_, first_needed_entry_);
   first_needed_entry_ = 0;
+  spare_value_ = Vars{};
+  has_spare_value_ = false;
+}
+
+template <typename Vars, typename DerivVars>
+inline void History<Vars, DerivVars>::linearize() noexcept {
+  std::rotate(
+      data_.begin(),
+      data_.begin() +
+          static_cast<typename decltype(data_.begin())::difference_type>(
+              start_),
+      data_.end());
+  start_ = 0;
 }
 
 template <typename Vars, typename DerivVars>
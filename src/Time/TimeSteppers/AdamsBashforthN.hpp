@@ -371,6 +371,9 @@ void AdamsBashforthN::update_u(
     const TimeDelta& time_step) const noexcept {
   update_u_impl(u, *history, time_step);
   history->mark_unneeded(history->begin() + 1);
+  // Only the derivatives of the past steps are used, so only the most
+  // recent value is kept.
+  history->mark_values_unneeded(history->end() - 1);
 }
 
 template <typename Vars, typename DerivVars>
@@ -0,0 +1,102 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+/// \endcond
+
+namespace {
+using SurfaceHistory =
+    std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>;
+
+const std::array<double, 3> center{{0.1, 0.2, 0.3}};
+
+// A distorted sphere whose coefficients depend on time through `radius`
+// and `distortion`
+Strahlkorper<Frame::Inertial> make_surface(const size_t l_max,
+                                           const double radius,
+                                           const double distortion) noexcept {
+  const Strahlkorper<Frame::Inertial> sphere(l_max, l_max, radius, center);
+  DataVector coefs = sphere.coefficients();
+  for (size_t i = 1; i < coefs.size(); ++i) {
+    coefs[i] += distortion * static_cast<double>(i % 5) / coefs.size();
+  }
+  return Strahlkorper<Frame::Inertial>(std::move(coefs), sphere);
+}
+
+void check_surface(const Strahlkorper<Frame::Inertial>& computed,
+                   const Strahlkorper<Frame::Inertial>& expected) noexcept {
+  CHECK(computed.l_max() == expected.l_max());
+  CHECK(computed.m_max() == expected.m_max());
+  CHECK(computed.center() == expected.center());
+  CHECK_ITERABLE_APPROX(computed.coefficients(), expected.coefficients());
+}
+
+void test_single_surface() noexcept {
+  const auto surface = make_surface(6, 2.0, 0.1);
+  check_surface(ah::extrapolate_strahlkorper(SurfaceHistory{{1.0, surface}},
+                                             3.0),
+                surface);
+}
+
+void test_polynomial_in_time() noexcept {
+  // Linear in time through two surfaces
+  const auto linear = [](const double t) noexcept {
+    return make_surface(6, 2.0 + 0.5 * t, 0.1 - 0.2 * t);
+  };
+  check_surface(
+      ah::extrapolate_strahlkorper(
+          SurfaceHistory{{1.0, linear(1.0)}, {0.5, linear(0.5)}}, 1.7),
+      linear(1.7));
+
+  // Quadratic in time through three surfaces
+  const auto quadratic = [](const double t) noexcept {
+    return make_surface(6, 2.0 + 0.5 * t - 0.3 * t * t, 0.1 + 0.4 * t * t);
+  };
+  check_surface(ah::extrapolate_strahlkorper(
+                    SurfaceHistory{{1.0, quadratic(1.0)},
+                                   {0.75, quadratic(0.75)},
+                                   {0.25, quadratic(0.25)}},
+                    1.4),
+                quadratic(1.4));
+}
+
+void test_different_resolution() noexcept {
+  // Surfaces with a different resolution than the most recent one, and the
+  // surfaces older than them, are not used
+  const auto linear = [](const size_t l_max, const double t) noexcept {
+    return make_surface(l_max, 2.0 + 0.5 * t, 0.1 - 0.2 * t);
+  };
+  check_surface(ah::extrapolate_strahlkorper(
+                    SurfaceHistory{{1.0, linear(6, 1.0)},
+                                   {0.5, linear(6, 0.5)},
+                                   {0.25, make_surface(8, 3.0, 0.0)},
+                                   {0.0, linear(6, 0.0)}},
+                    1.7),
+                linear(6, 1.7));
+  check_surface(
+      ah::extrapolate_strahlkorper(
+          SurfaceHistory{{1.0, linear(6, 1.0)}, {0.5, linear(8, 0.5)}}, 1.7),
+      linear(6, 1.0));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ApparentHorizons.ExtrapolateStrahlkorper",
+                  "[ApparentHorizons][Unit]") {
+  test_single_surface();
+  test_polynomial_in_time();
+  test_different_resolution();
+}
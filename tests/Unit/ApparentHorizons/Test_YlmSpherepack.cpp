@@ -291,6 +291,20 @@ void test_gradient(const size_t l_max, const size_t m_max,
           CHECK(gsl::at(dutest, d)[s] == approx(du_simple.get(d)[s]));
         }
       }
+
+      // Test gradients of several functions at once
+      const DataVector two_u = 2.0 * u;
+      const DataVector u_plus_one = u + 1.0;
+      const auto du_batch =
+          ylm_spherepack.gradients<3>({{&u, &two_u, &u_plus_one}});
+      for (size_t d = 0; d < 2; ++d) {
+        for (size_t s = 0; s < physical_size; ++s) {
+          CHECK(gsl::at(dutest, d)[s] == approx(du_batch[0].get(d)[s]));
+          CHECK(2.0 * gsl::at(dutest, d)[s] ==
+                approx(du_batch[1].get(d)[s]));
+          CHECK(gsl::at(dutest, d)[s] == approx(du_batch[2].get(d)[s]));
+        }
+      }
     } else {
       // Test simplified interface of gradient for non-unit stride
       auto du_simple = ylm_spherepack.gradient(u, physical_stride);
@@ -0,0 +1,184 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "ControlSystem/UpdateFunctionsOfTime.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
+#include "Domain/FunctionsOfTime/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Time/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+using FunctionsOfTimeMap = std::unordered_map<
+    std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using simple_tags =
+      db::AddSimpleTags<Tags::Time, domain::Tags::FunctionsOfTime>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<control_system::Actions::UpdateFunctionsOfTime>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Component<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+using component = Component<Metavariables>;
+using updates_tag = control_system::Tags::FunctionOfTimeUpdates;
+
+FunctionsOfTimeMap make_functions_of_time() noexcept {
+  FunctionsOfTimeMap functions_of_time{};
+  // x**2 until the first update
+  functions_of_time["Rotation"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          0.0, std::array<DataVector, 3>{{{0.0}, {0.0}, {2.0}}}, 1.0);
+  functions_of_time["Expansion"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          0.0, std::array<DataVector, 3>{{{1.0}, {0.0}, {0.0}}});
+  return functions_of_time;
+}
+
+void set_time(const gsl::not_null<ActionTesting::MockRuntimeSystem<
+                  Metavariables>*>
+                  runner,
+              const int id, const double time) noexcept {
+  db::mutate<Tags::Time>(
+      make_not_null(
+          &ActionTesting::get_databox<component, component::simple_tags>(
+              runner, id)),
+      [&time](const gsl::not_null<double*> local_time) noexcept {
+        *local_time = time;
+      });
+}
+
+const domain::FunctionsOfTime::FunctionOfTime& get_function_of_time(
+    const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
+    const int id, const std::string& name) noexcept {
+  return *ActionTesting::get_databox_tag<component,
+                                         domain::Tags::FunctionsOfTime>(
+              runner, id)
+              .at(name);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionsOfTime",
+                  "[ControlSystem][Unit][Actions]") {
+  domain::FunctionsOfTime::register_derived_with_charm();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{1.0}};
+  for (const int id : {0, 1}) {
+    ActionTesting::emplace_component_and_initialize<component>(
+        &runner, id, {0.5, make_functions_of_time()});
+  }
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+
+  // Nothing has expired yet
+  CHECK(ActionTesting::is_ready<component>(runner, 0));
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  CHECK(get_function_of_time(runner, 0, "Rotation").expiration_time() == 1.0);
+
+  // The element has to wait for an update of the expired function of time
+  set_time(make_not_null(&runner), 0, 1.5);
+  CHECK_FALSE(ActionTesting::is_ready<component>(runner, 0));
+
+  // An update arriving out of order doesn't help...
+  control_system::send_function_of_time_update<component>(
+      runner.cache(), "Rotation", 2.0, DataVector{0.0}, 3.0);
+  CHECK_FALSE(ActionTesting::is_ready<component>(runner, 0));
+  // ...until the update it follows has been received
+  control_system::send_function_of_time_update<component>(
+      runner.cache(), "Rotation", 1.0, DataVector{4.0}, 2.0);
+  CHECK(ActionTesting::is_ready<component>(runner, 0));
+  // An element that doesn't need the function past its expiration doesn't
+  // wait for the updates
+  CHECK(ActionTesting::is_ready<component>(runner, 1));
+  CHECK(
+      tuples::get<updates_tag>(runner.inboxes<component>().at(1)).size() == 2);
+
+  // Both updates are applied, in time order
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  CHECK(tuples::get<updates_tag>(runner.inboxes<component>().at(0)).empty());
+  const auto& rotation = get_function_of_time(runner, 0, "Rotation");
+  CHECK(rotation.expiration_time() == 3.0);
+  CHECK(rotation.func(1.0)[0][0] == approx(1.0));
+  CHECK(rotation.func(2.0)[0][0] == approx(5.0));
+  CHECK(rotation.func_and_deriv(3.0)[1][0] == approx(6.0));
+  CHECK(rotation.func(3.0)[0][0] == approx(11.0));
+  const auto& expansion = get_function_of_time(runner, 0, "Expansion");
+  CHECK(expansion.expiration_time() == std::numeric_limits<double>::max());
+  CHECK(expansion.func(3.0)[0][0] == approx(1.0));
+
+  // Without updates the functions of time are left alone...
+  set_time(make_not_null(&runner), 0, 3.0);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  CHECK(get_function_of_time(runner, 0, "Rotation").time_bounds()[0] == 0.0);
+  // ...and when an update arrives the segments more than the retention time
+  // before the current time are discarded
+  control_system::send_function_of_time_update<component>(
+      runner.cache(), "Rotation", 3.0, DataVector{0.0}, 4.0);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  const auto& truncated_rotation = get_function_of_time(runner, 0, "Rotation");
+  CHECK(truncated_rotation.time_bounds()[0] == 2.0);
+  CHECK(truncated_rotation.expiration_time() == 4.0);
+  CHECK(truncated_rotation.func(3.0)[0][0] == approx(11.0));
+
+  // Past the last expiration time the element waits again
+  set_time(make_not_null(&runner), 0, 4.5);
+  CHECK_FALSE(ActionTesting::is_ready<component>(runner, 0));
+
+  // The other element applies the same updates
+  ActionTesting::next_action<component>(make_not_null(&runner), 1);
+  CHECK(get_function_of_time(runner, 1, "Rotation").expiration_time() == 4.0);
+  CHECK(get_function_of_time(runner, 1, "Rotation").func(3.0)[0][0] ==
+        approx(11.0));
+
+  // An update that was already applied is discarded
+  control_system::send_function_of_time_update<component>(
+      runner.cache(), "Rotation", 1.0, DataVector{4.0}, 2.0);
+  ActionTesting::next_action<component>(make_not_null(&runner), 1);
+  CHECK(tuples::get<updates_tag>(runner.inboxes<component>().at(1)).empty());
+  CHECK(get_function_of_time(runner, 1, "Rotation").expiration_time() == 4.0);
+}
+
+// [[OutputRegex, Received an update for the function of time 'Translation',
+// which is not one of the functions of time.]]
+SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionsOfTime.UnknownFunction",
+                  "[ControlSystem][Unit][Actions]") {
+  ERROR_TEST();
+  domain::FunctionsOfTime::register_derived_with_charm();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{1.0}};
+  ActionTesting::emplace_component_and_initialize<component>(
+      &runner, 0, {0.5, make_functions_of_time()});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+  control_system::send_function_of_time_update<component>(
+      runner.cache(), "Translation", 1.0, DataVector{4.0}, 2.0);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+}
@@ -7,10 +7,13 @@
 #include <iterator>
 #include <numeric>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Expressions/AddSubtract.hpp"
+#include "DataStructures/Tensor/Expressions/Contract.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.AddSubtract",
@@ -72,3 +75,78 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.AddSubtract",
     }
   }
 }
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.EvaluateDataVector",
+                  "[DataStructures][Unit]") {
+  const size_t num_points = 5;
+  Tensor<DataVector, Symmetry<1, 1>,
+         index_list<SpatialIndex<3, UpLo::Lo, Frame::Grid>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Grid>>>
+      All(num_points);
+  Tensor<DataVector, Symmetry<2, 1>,
+         index_list<SpatialIndex<3, UpLo::Lo, Frame::Grid>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Grid>>>
+      Hll(num_points);
+  for (size_t i = 0; i < All.size(); ++i) {
+    std::iota(All[i].begin(), All[i].end(), static_cast<double>(i));
+  }
+  for (size_t i = 0; i < Hll.size(); ++i) {
+    std::iota(Hll[i].rbegin(), Hll[i].rend(), -static_cast<double>(i));
+  }
+
+  auto Gll = TensorExpressions::evaluate<ti_a_t, ti_b_t>(
+      All(ti_a, ti_b) + Hll(ti_b, ti_a) - All(ti_b, ti_a));
+
+  // Evaluating into an existing Tensor must give the same result, both when
+  // the components need to be allocated and when they are reused.
+  Tensor<DataVector, Symmetry<2, 1>,
+         index_list<SpatialIndex<3, UpLo::Lo, Frame::Grid>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Grid>>>
+      Gll2{}, Gll3(num_points);
+  TensorExpressions::evaluate<ti_a_t, ti_b_t>(
+      make_not_null(&Gll2), All(ti_a, ti_b) + Hll(ti_b, ti_a) -
+                                All(ti_b, ti_a));
+  const double* const data_before = Gll3.get(0, 1).data();
+  TensorExpressions::evaluate<ti_a_t, ti_b_t>(
+      make_not_null(&Gll3), All(ti_a, ti_b) + Hll(ti_b, ti_a) -
+                                All(ti_b, ti_a));
+  CHECK(Gll3.get(0, 1).data() == data_before);
+
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      const DataVector expected = Hll.get(j, i);
+      CHECK(Gll.get(i, j) == expected);
+      CHECK(Gll2.get(i, j) == expected);
+      CHECK(Gll3.get(i, j) == expected);
+    }
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.EvaluateContraction",
+                  "[DataStructures][Unit]") {
+  const size_t num_points = 4;
+  Tensor<DataVector, Symmetry<3, 2, 1>,
+         index_list<SpatialIndex<3, UpLo::Up, Frame::Grid>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Grid>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Grid>>>
+      Rull(num_points);
+  for (size_t i = 0; i < Rull.size(); ++i) {
+    std::iota(Rull[i].begin(), Rull[i].end(), static_cast<double>(i));
+  }
+  Tensor<DataVector, Symmetry<1>,
+         index_list<SpatialIndex<3, UpLo::Lo, Frame::Grid>>>
+      Sl(num_points);
+
+  // Evaluating a contraction into an existing Tensor
+  const auto Rl = TensorExpressions::evaluate<ti_b_t>(Rull(ti_A, ti_a, ti_b));
+  TensorExpressions::evaluate<ti_b_t>(make_not_null(&Sl),
+                                      Rull(ti_A, ti_a, ti_b));
+  for (size_t b = 0; b < 3; ++b) {
+    DataVector expected(num_points, 0.0);
+    for (size_t a = 0; a < 3; ++a) {
+      expected += Rull.get(a, a, b);
+    }
+    CHECK(Rl.get(b) == expected);
+    CHECK(Sl.get(b) == expected);
+  }
+}
@@ -1364,6 +1364,22 @@ void test_coords_frame_velocity_jacobians() noexcept {
             tnsr::I<DataVector, 1, Frame::Logical>{DataVector{-0.5, 0.0, 0.5}},
             time, functions_of_time)) ==
         tnsr::I<DataVector, 1, Frame::Inertial>{3_st, -2.0 + 1.15 * -2.0});
+  // The translations have identity Jacobians, so only the affine map
+  // contributes to the composed Jacobians.
+  {
+    const auto coords_jacs_velocity =
+        composed_map_1d.coords_frame_velocity_jacobians(
+            tnsr::I<double, 1, Frame::Logical>{0.5}, time, functions_of_time);
+    CHECK(get<0, 0>(std::get<1>(coords_jacs_velocity)) ==
+          approx(1.0 / 1.15));
+    CHECK(get<0, 0>(std::get<2>(coords_jacs_velocity)) == approx(1.15));
+    CHECK(get<0, 0>(composed_map_1d.inv_jacobian(
+              tnsr::I<double, 1, Frame::Logical>{0.5}, time,
+              functions_of_time)) == approx(1.0 / 1.15));
+    CHECK(get<0, 0>(composed_map_1d.jacobian(
+              tnsr::I<double, 1, Frame::Logical>{0.5}, time,
+              functions_of_time)) == approx(1.15));
+  }
 
   const auto composed_map_2d =
       make_coordinate_map<Frame::Logical, Frame::Inertial>(
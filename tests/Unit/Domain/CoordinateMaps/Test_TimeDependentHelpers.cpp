@@ -65,6 +65,12 @@ struct TimeIndepJac {
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> jacobian(
       const std::array<T, Dim>& source_coords) const noexcept;
 };
+
+template <bool IsIdentity>
+struct IdentityJac {
+  static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_identity = IsIdentity;
+};
 }  // namespace
 
 namespace domain {
@@ -146,4 +152,17 @@ static_assert(not is_jacobian_time_dependent_v<TimeIndepJac<3>, DataVector>,
               "Failed testing is_jacobian_time_dependent_t");
 static_assert(not is_jacobian_time_dependent_v<TimeIndepJac<3>, double>,
               "Failed testing is_jacobian_time_dependent_t");
+
+static_assert(is_jacobian_identity<IdentityJac<true>>::value,
+              "Failed testing is_jacobian_identity");
+static_assert(not is_jacobian_identity<IdentityJac<false>>::value,
+              "Failed testing is_jacobian_identity");
+static_assert(not is_jacobian_identity<TimeIndepJac<3>>::value,
+              "Failed testing is_jacobian_identity");
+static_assert(is_jacobian_identity_v<IdentityJac<true>>,
+              "Failed testing is_jacobian_identity_v");
+static_assert(not is_jacobian_identity_v<IdentityJac<false>>,
+              "Failed testing is_jacobian_identity_v");
+static_assert(not is_jacobian_identity_v<TimeDepJac<3>>,
+              "Failed testing is_jacobian_identity_v");
 }  // namespace domain
@@ -17,6 +17,7 @@
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.tpp"
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Domain/LogicalCoordinates.hpp"
@@ -46,6 +47,12 @@ void test_product_of_2_maps_time_dep(
   static_assert(
       std::is_same_v<Map2, AffineMap> or std::is_same_v<Map2, TranslationMap>,
       "Map2 must be either an affine map or a translation map");
+  static_assert(
+      domain::is_jacobian_identity_v<
+          CoordinateMaps::TimeDependent::ProductOf2Maps<Map1, Map2>> ==
+          (std::is_same_v<Map1, TranslationMap> and
+           std::is_same_v<Map2, TranslationMap>),
+      "Only a product of translations has an identity Jacobian");
 
   const std::array<double, 2> point_source_a{{x_source_a, y_source_a}};
   const std::array<double, 2> point_source_b{{x_source_b, y_source_b}};
@@ -13,6 +13,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Framework/TestHelpers.hpp"
@@ -41,6 +42,9 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.TimeDependent.Translation",
   const FoftPtr& f_of_t = f_of_t_list.at("translation");
 
   const CoordinateMaps::TimeDependent::Translation trans_map{"translation"};
+  static_assert(
+      is_jacobian_identity_v<CoordinateMaps::TimeDependent::Translation>,
+      "The Jacobian of the Translation map must be flagged as the identity");
   // test serialized/deserialized map
   const auto trans_map_deserialized = serialize_and_deserialize(trans_map);
 
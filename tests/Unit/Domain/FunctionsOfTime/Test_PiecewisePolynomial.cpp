@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <limits>
 #include <memory>
 
 #include "DataStructures/DataVector.hpp"
@@ -17,6 +18,8 @@
 
 namespace domain {
 namespace {
+using FunctionOfTimeBase = FunctionsOfTime::FunctionOfTime;
+
 template <size_t DerivOrder>
 void test(const gsl::not_null<FunctionsOfTime::FunctionOfTime*> f_of_t,
           const gsl::not_null<FunctionsOfTime::PiecewisePolynomial<DerivOrder>*>
@@ -221,6 +224,80 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
     test_within_roundoff<deriv_order>(f_of_t);
     test_within_roundoff<deriv_order>(f_of_t2);
   }
+  {
+    INFO("Test expiration time.");
+    constexpr size_t deriv_order = 2;
+    // initially x**2
+    FunctionsOfTime::PiecewisePolynomial<deriv_order> never_expires(
+        0.0, {{{0.0}, {0.0}, {2.0}}});
+    CHECK(never_expires.expiration_time() ==
+          std::numeric_limits<double>::max());
+    never_expires.update(1.0, {4.0});
+    CHECK(never_expires.expiration_time() ==
+          std::numeric_limits<double>::max());
+
+    FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t(
+        0.0, {{{0.0}, {0.0}, {2.0}}}, 1.0);
+    CHECK(f_of_t.expiration_time() == 1.0);
+    CHECK(f_of_t != FunctionsOfTime::PiecewisePolynomial<deriv_order>(
+                        0.0, {{{0.0}, {0.0}, {2.0}}}));
+    CHECK(f_of_t.func(1.0)[0][0] == approx(1.0));
+
+    // update through the base class, as the elements do
+    std::unique_ptr<FunctionsOfTime::FunctionOfTime> base_f_of_t =
+        f_of_t.get_clone();
+    base_f_of_t->update(1.0, {4.0}, 2.5);
+    f_of_t.update(1.0, {4.0}, 2.5);
+    CHECK(base_f_of_t->expiration_time() == 2.5);
+    CHECK(f_of_t.expiration_time() == 2.5);
+    using Polynomial = FunctionsOfTime::PiecewisePolynomial<deriv_order>;
+    CHECK(f_of_t == dynamic_cast<const Polynomial&>(*base_f_of_t));
+    CHECK(serialize_and_deserialize(f_of_t) == f_of_t);
+
+    // the update keeps the function continuous and starts the new segment
+    const auto values = f_of_t.func_and_2_derivs(2.0);
+    CHECK(values[0][0] == approx(5.0));
+    CHECK(values[1][0] == approx(6.0));
+    CHECK(values[2][0] == approx(4.0));
+    // the update may come later than the expiration
+    f_of_t.update(3.0, {0.0}, 4.0);
+    CHECK(f_of_t.expiration_time() == 4.0);
+    CHECK(f_of_t.func(4.0)[0][0] == approx(23.0));
+  }
+  {
+    INFO("Test segment lookup and truncation.");
+    constexpr size_t deriv_order = 2;
+    FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t(
+        0.0, {{{0.0, 1.0}, {0.0, 0.0}, {2.0, 0.0}}});
+    for (size_t i = 1; i < 20; ++i) {
+      f_of_t.update(static_cast<double>(i),
+                    {static_cast<double>(i % 3), 0.0});
+    }
+    const FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t_copy =
+        serialize_and_deserialize(f_of_t);
+
+    // The lookup from the last used segment agrees with a fresh lookup, for
+    // increasing times, repeated times, and times going backwards.
+    for (const double t : {0.5, 0.5, 1.0, 1.7, 2.3, 5.9, 5.2, 0.1, 19.5}) {
+      CAPTURE(t);
+      CHECK_ITERABLE_APPROX(f_of_t.func_and_2_derivs(t),
+                            f_of_t_copy.func_and_2_derivs(t));
+    }
+
+    // Truncation keeps the segment containing the truncation time
+    f_of_t.truncate_before(12.5);
+    CHECK(f_of_t.time_bounds()[0] == 12.0);
+    CHECK(f_of_t.time_bounds()[1] == 19.0);
+    for (const double t : {12.0, 12.5, 15.3, 19.5}) {
+      CHECK_ITERABLE_APPROX(f_of_t.func_and_2_derivs(t),
+                            f_of_t_copy.func_and_2_derivs(t));
+    }
+    f_of_t.truncate_before(12.7);
+    CHECK(f_of_t.time_bounds()[0] == 12.0);
+    f_of_t.truncate_before(30.0);
+    CHECK(f_of_t.time_bounds()[0] == 19.0);
+    CHECK_ITERABLE_APPROX(f_of_t.func(20.0), f_of_t_copy.func(20.0));
+  }
 }
 
 // [[OutputRegex, t must be increasing from call to call. Attempted to update at
@@ -265,4 +342,36 @@ SPECTRE_TEST_CASE(
   f_of_t.update(2.0, {6.0, 0.0});
   f_of_t.func(0.5);
 }
+
+// [[OutputRegex, requested time 2 is past the expiration time 1.5. Wait for
+// an update before evaluating.]]
+SPECTRE_TEST_CASE(
+    "Unit.Domain.FunctionsOfTime.PiecewisePolynomial.EvaluateExpired",
+    "[Domain][Unit]") {
+  ERROR_TEST();
+  FunctionsOfTime::PiecewisePolynomial<2> f_of_t(0.0, {{{0.0}, {0.0}, {2.0}}},
+                                                 1.5);
+  f_of_t.func(2.0);
+}
+
+// [[OutputRegex, Attempted to update at time 1, which precedes the expiration
+// time 1.5.]]
+SPECTRE_TEST_CASE(
+    "Unit.Domain.FunctionsOfTime.PiecewisePolynomial.UpdateBeforeExpiration",
+    "[Domain][Unit]") {
+  ERROR_TEST();
+  FunctionsOfTime::PiecewisePolynomial<2> f_of_t(0.0, {{{0.0}, {0.0}, {2.0}}},
+                                                 1.5);
+  f_of_t.update(1.0, {4.0}, 3.0);
+}
+
+// [[OutputRegex, The next expiration time 1 precedes the update time 2.]]
+SPECTRE_TEST_CASE(
+    "Unit.Domain.FunctionsOfTime.PiecewisePolynomial.BadExpirationTime",
+    "[Domain][Unit]") {
+  ERROR_TEST();
+  FunctionsOfTime::PiecewisePolynomial<2> f_of_t(0.0, {{{0.0}, {0.0}, {2.0}}},
+                                                 1.5);
+  f_of_t.update(2.0, {4.0}, 1.0);
+}
 }  // namespace domain
@@ -0,0 +1,213 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/Creators/Interval.hpp"
+#include "Domain/Creators/Rectangle.hpp"
+#include "Domain/Creators/RotatedRectangles.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/OptionTags.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Checks the properties every distribution must have: each element appears
+// exactly once, the processors are assigned in contiguous chunks, and no
+// processor has more than its share of the cost plus one element.
+template <size_t Dim>
+void check_distribution(
+    const std::vector<std::pair<ElementId<Dim>, size_t>>& distribution,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const size_t number_of_procs) noexcept {
+  const auto expected_element_ids =
+      initial_element_ids(initial_refinement_levels);
+  REQUIRE(distribution.size() == expected_element_ids.size());
+  std::unordered_set<ElementId<Dim>> distributed_element_ids{};
+  for (const auto& element_id_and_proc : distribution) {
+    distributed_element_ids.insert(element_id_and_proc.first);
+  }
+  for (const auto& element_id : expected_element_ids) {
+    CHECK(distributed_element_ids.count(element_id) == 1);
+  }
+
+  std::vector<double> proc_costs(number_of_procs, 0.0);
+  double total_cost = 0.0;
+  double max_element_cost = 0.0;
+  for (size_t i = 0; i < distribution.size(); ++i) {
+    const size_t proc = distribution[i].second;
+    REQUIRE(proc < number_of_procs);
+    if (i > 0) {
+      CHECK(proc >= distribution[i - 1].second);
+    }
+    double cost = 1.0;
+    for (const size_t extent :
+         initial_extents[distribution[i].first.block_id()]) {
+      cost *= static_cast<double>(extent);
+    }
+    proc_costs[proc] += cost;
+    total_cost += cost;
+    max_element_cost = std::max(max_element_cost, cost);
+  }
+  for (const double proc_cost : proc_costs) {
+    CHECK(proc_cost <=
+          total_cost / static_cast<double>(number_of_procs) + max_element_cost);
+  }
+}
+
+void test_interval() noexcept {
+  const domain::creators::Interval interval{
+      {{-1.0}}, {{1.0}}, {{false}}, {{2}}, {{4}}};
+  const auto distribution = domain::z_curve_element_distribution(
+      interval.create_domain().blocks(), interval.initial_refinement_levels(),
+      interval.initial_extents(), 2);
+  REQUIRE(distribution.size() == 4);
+  for (size_t i = 0; i < 4; ++i) {
+    CHECK(distribution[i].first == ElementId<1>{0, {{SegmentId{2, i}}}});
+    CHECK(distribution[i].second == i / 2);
+  }
+  check_distribution(distribution, interval.initial_refinement_levels(),
+                     interval.initial_extents(), 2);
+}
+
+void test_rectangle() noexcept {
+  const domain::creators::Rectangle rectangle{
+      {{-1.0, -1.0}}, {{1.0, 1.0}}, {{false, false}}, {{1, 1}}, {{3, 3}}};
+  const auto distribution = domain::z_curve_element_distribution(
+      rectangle.create_domain().blocks(),
+      rectangle.initial_refinement_levels(), rectangle.initial_extents(), 4);
+  // the elements follow a Z-curve through the block
+  const std::array<std::pair<size_t, size_t>, 4> expected_indices{
+      {{0, 0}, {0, 1}, {1, 0}, {1, 1}}};
+  REQUIRE(distribution.size() == 4);
+  for (size_t i = 0; i < 4; ++i) {
+    CHECK(distribution[i].first ==
+          ElementId<2>{0,
+                       {{SegmentId{1, gsl::at(expected_indices, i).first},
+                         SegmentId{1, gsl::at(expected_indices, i).second}}}});
+    CHECK(distribution[i].second == i);
+  }
+
+  // with more processors than elements, each element gets its own processor
+  const auto sparse_distribution = domain::z_curve_element_distribution(
+      rectangle.create_domain().blocks(),
+      rectangle.initial_refinement_levels(), rectangle.initial_extents(), 10);
+  check_distribution(sparse_distribution,
+                     rectangle.initial_refinement_levels(),
+                     rectangle.initial_extents(), 10);
+  for (size_t i = 1; i < sparse_distribution.size(); ++i) {
+    CHECK(sparse_distribution[i].second > sparse_distribution[i - 1].second);
+  }
+}
+
+void test_rotated_rectangles() noexcept {
+  const domain::creators::RotatedRectangles rotated_rectangles{
+      {{-1.0, -1.0}},   {{0.0, 0.0}}, {{1.0, 1.0}},
+      {{false, false}}, {{2, 1}},     {{{{3, 5}}, {{4, 6}}}}};
+  const auto rotated_domain = rotated_rectangles.create_domain();
+  const auto& blocks = rotated_domain.blocks();
+  for (const size_t number_of_procs : {1_st, 3_st, 7_st}) {
+    const auto distribution = domain::z_curve_element_distribution(
+        blocks, rotated_rectangles.initial_refinement_levels(),
+        rotated_rectangles.initial_extents(), number_of_procs);
+    check_distribution(distribution,
+                       rotated_rectangles.initial_refinement_levels(),
+                       rotated_rectangles.initial_extents(), number_of_procs);
+    // each block is reached through a face of a block placed before it
+    std::vector<size_t> block_order{};
+    for (const auto& element_id_and_proc : distribution) {
+      const size_t block_id = element_id_and_proc.first.block_id();
+      if (block_order.empty() or block_order.back() != block_id) {
+        block_order.push_back(block_id);
+      }
+    }
+    REQUIRE(block_order.size() == 4);
+    CHECK(block_order.front() == 0);
+    for (size_t i = 1; i < block_order.size(); ++i) {
+      const auto& neighbors = blocks[block_order[i]].neighbors();
+      CHECK(std::any_of(
+          block_order.begin(), block_order.begin() + static_cast<ptrdiff_t>(i),
+          [&neighbors](const size_t earlier_block) noexcept {
+            return std::any_of(
+                neighbors.begin(), neighbors.end(),
+                [&earlier_block](const auto& direction_and_neighbor) noexcept {
+                  return direction_and_neighbor.second.id() == earlier_block;
+                });
+          }));
+    }
+  }
+}
+
+void test_round_robin() noexcept {
+  const domain::creators::Rectangle rectangle{
+      {{-1.0, -1.0}}, {{1.0, 1.0}}, {{false, false}}, {{1, 1}}, {{3, 3}}};
+  const auto blocks = rectangle.create_domain().blocks();
+  const auto expected_element_ids =
+      initial_element_ids(rectangle.initial_refinement_levels());
+  for (const size_t number_of_procs : {1_st, 3_st, 7_st}) {
+    const auto distribution = domain::round_robin_element_distribution(
+        blocks, rectangle.initial_refinement_levels(), number_of_procs);
+    REQUIRE(distribution.size() == expected_element_ids.size());
+    for (size_t i = 0; i < distribution.size(); ++i) {
+      CHECK(distribution[i].first == expected_element_ids[i]);
+      CHECK(distribution[i].second == i % number_of_procs);
+    }
+    CHECK(domain::element_distribution(
+              domain::ElementPlacement::RoundRobin, blocks,
+              rectangle.initial_refinement_levels(),
+              rectangle.initial_extents(), number_of_procs) == distribution);
+    CHECK(domain::element_distribution(
+              domain::ElementPlacement::ZCurve, blocks,
+              rectangle.initial_refinement_levels(),
+              rectangle.initial_extents(), number_of_procs) ==
+          domain::z_curve_element_distribution(
+              blocks, rectangle.initial_refinement_levels(),
+              rectangle.initial_extents(), number_of_procs));
+  }
+}
+
+void test_element_placement_option() noexcept {
+  using option_tag = domain::OptionTags::ElementPlacement;
+  Options<tmpl::list<option_tag>> default_opts("");
+  default_opts.parse("");
+  CHECK(default_opts.get<option_tag>() == domain::ElementPlacement::ZCurve);
+  Options<tmpl::list<option_tag>> opts("");
+  opts.parse("ElementPlacement: RoundRobin\n");
+  CHECK(opts.get<option_tag>() == domain::ElementPlacement::RoundRobin);
+  CHECK(get_output(domain::ElementPlacement::RoundRobin) == "RoundRobin");
+  CHECK(get_output(domain::ElementPlacement::ZCurve) == "ZCurve");
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
+  test_interval();
+  test_rectangle();
+  test_rotated_rectangles();
+  test_round_robin();
+  test_element_placement_option();
+}
+
+// [[OutputRegex, Failed to convert "Spiral" to ElementPlacement]]
+SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution.BadOption",
+                  "[Domain][Unit]") {
+  ERROR_TEST();
+  Options<tmpl::list<domain::OptionTags::ElementPlacement>> opts("");
+  opts.parse("ElementPlacement: Spiral\n");  // Meant to fail.
+  opts.get<domain::OptionTags::ElementPlacement>();
+}
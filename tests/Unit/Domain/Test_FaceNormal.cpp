@@ -139,6 +139,19 @@ void check_time_dependent(
       CHECK_ITERABLE_APPROX(lower_normal.get(i),
                             DataVector{-inv_jacobian_lower.get(d, i)});
     }
+
+    // Computing the normal from the grid normal and grid coordinates on the
+    // face gives the same result
+    const Direction<Dim> upper_direction(d, Side::Upper);
+    tnsr::i<DataVector, Dim, Frame::Inertial> normal_from_grid{};
+    unnormalized_face_normal(
+        make_not_null(&normal_from_grid),
+        unnormalized_face_normal(interface_mesh, logical_to_grid_map,
+                                 upper_direction),
+        logical_to_grid_map(
+            interface_logical_coordinates(interface_mesh, upper_direction)),
+        *grid_to_inertial_map, time, functions_of_time);
+    CHECK_ITERABLE_APPROX(normal_from_grid, upper_normal);
   }
 
   // Now check the compute items
@@ -156,6 +169,16 @@ void check_time_dependent(
                                  Tags::Direction<Dim>>,
           Tags::InterfaceCompute<Tags::BoundaryDirectionsExterior<Dim>,
                                  Tags::InterfaceMesh<Dim>>,
+          Tags::InterfaceCompute<Directions<Dim>,
+                                 Tags::BoundaryGridCoordinates<Dim>>,
+          Tags::InterfaceCompute<
+              Directions<Dim>,
+              Tags::UnnormalizedFaceNormalCompute<Dim, Frame::Grid>>,
+          Tags::InterfaceCompute<Tags::BoundaryDirectionsExterior<Dim>,
+                                 Tags::BoundaryGridCoordinates<Dim>>,
+          Tags::InterfaceCompute<
+              Tags::BoundaryDirectionsExterior<Dim>,
+              Tags::UnnormalizedFaceNormalCompute<Dim, Frame::Grid>>,
           Tags::InterfaceCompute<
               Tags::BoundaryDirectionsExterior<Dim>,
               Tags::UnnormalizedFaceNormalMovingMeshCompute<Dim>>,
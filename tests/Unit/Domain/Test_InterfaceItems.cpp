@@ -575,6 +575,8 @@ void test_boundary_coordinates_moving_mesh_impl(
       db::AddComputeTags<
           Tags::InterfaceCompute<Directions<Dim>, Tags::Direction<Dim>>,
           Tags::InterfaceCompute<Directions<Dim>, Tags::InterfaceMesh<Dim>>,
+          Tags::InterfaceCompute<Directions<Dim>,
+                                 Tags::BoundaryGridCoordinates<Dim>>,
           Tags::InterfaceCompute<Directions<Dim>,
                                  Tags::BoundaryCoordinates<Dim, true>>>>(
       mesh, get_directions<Dim>(),
@@ -124,6 +124,7 @@ SPECTRE_TEST_CASE("Unit.Domain.Tags", "[Unit][Domain]") {
   test_simple_tags<1>();
   test_simple_tags<2>();
   test_simple_tags<3>();
+  TestHelpers::db::test_simple_tag<Tags::ElementPlacement>("ElementPlacement");
 
   test_compute_tags<1>();
   test_compute_tags<2>();
@@ -83,21 +83,30 @@ class DummyLimiterForTest {
   using limit_tags = tmpl::list<Var>;
   using limit_argument_tags =
       tmpl::list<domain::Tags::Mesh<2>, domain::Tags::Element<2>>;
-  void operator()(const gsl::not_null<db::item_type<Var>*> var,
+  bool operator()(const gsl::not_null<db::item_type<Var>*> var,
                   const Mesh<2>& /*mesh*/, const Element<2>& /*element*/,
                   const std::unordered_map<
                       std::pair<Direction<2>, ElementId<2>>,
                       DummyLimiterForTest::PackagedData,
                       boost::hash<std::pair<Direction<2>, ElementId<2>>>>&
                       neighbor_packaged_data) const noexcept {
+    if (disabled) {
+      return false;
+    }
     // Zero the data as an easy check that the limiter got called
     get(*var) = 0.;
     for (const auto& data : neighbor_packaged_data) {
       get(*var) += data.second.mean_;
     }
+    return true;
   }
 
-  void pup(const PUP::er& /*p*/) const noexcept {}
+  bool is_disabled() const noexcept { return disabled; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept { p | disabled; }
+
+  bool disabled = false;
 };
 
 struct LimiterTag {
@@ -358,3 +367,58 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.LimiterActions.NoNeighbors",
   CHECK_ITERABLE_APPROX(var_to_limit,
                         Scalar<DataVector>(mesh.number_of_grid_points(), 0.));
 }
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.LimiterActions.Disabled",
+                  "[Unit][NumericalAlgorithms][Actions]") {
+  using metavariables = Metavariables<2>;
+  using my_component = component<2, metavariables>;
+  using limiter_comm_tag =
+      Limiters::Tags::LimiterCommunicationTag<metavariables>;
+
+  const Mesh<2> mesh{
+      {{3, 4}}, Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto};
+  const ElementId<2> self_id(0, {{{1, 0}, {0, 0}}});
+  const ElementId<2> east_id(0, {{{1, 1}, {0, 0}}});
+
+  using Affine = domain::CoordinateMaps::Affine;
+  using Affine2D = domain::CoordinateMaps::ProductOf2Maps<Affine, Affine>;
+  PUPable_reg(SINGLE_ARG(
+      domain::CoordinateMap<Frame::Logical, Frame::Inertial, Affine2D>));
+  const auto coordmap =
+      domain::make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+          Affine2D(Affine{-1., 1., 3., 7.}, Affine{-1., 1., 7., 3.}));
+
+  DummyLimiterForTest disabled_limiter{};
+  disabled_limiter.disabled = true;
+  ActionTesting::MockRuntimeSystem<metavariables> runner{
+      {std::move(disabled_limiter)}};
+
+  ActionTesting::emplace_component_and_initialize<my_component>(
+      &runner, self_id,
+      {0, mesh,
+       Element<2>(self_id, {{Direction<2>::upper_xi(), {{east_id}, {}}}}),
+       ElementMap<2, Frame::Inertial>(self_id, coordmap->get_clone()),
+       Scalar<DataVector>(mesh.number_of_grid_points(), 1234.)});
+  ActionTesting::emplace_component_and_initialize<my_component>(
+      &runner, east_id,
+      {0, mesh,
+       Element<2>(east_id, {{Direction<2>::lower_xi(), {{self_id}, {}}}}),
+       ElementMap<2, Frame::Inertial>(east_id, coordmap->get_clone()),
+       Scalar<DataVector>(mesh.number_of_grid_points(), 6.)});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           metavariables::Phase::Testing);
+
+  // Nothing is sent to the neighbor, and the limiter doesn't wait for data
+  // from it.
+  runner.next_action<my_component>(self_id);
+  CHECK(runner.nonempty_inboxes<my_component, limiter_comm_tag>().empty());
+  CHECK(runner.is_ready<my_component>(self_id));
+
+  runner.next_action<my_component>(self_id);
+  CHECK_ITERABLE_APPROX(
+      (ActionTesting::get_databox_tag<my_component, Var>(runner, self_id)),
+      Scalar<DataVector>(mesh.number_of_grid_points(), 1234.));
+  CHECK(
+      tuples::get<limiter_comm_tag>(runner.inboxes<my_component>().at(self_id))
+          .empty());
+}
@@ -509,6 +509,35 @@ void test_spec_worldtube_buffer_updater(
       make_not_null(&time_span_end_from_serialized), target_time, l_max,
       interpolator_length, buffer_size);
 
+  // advancing the span reuses the overlapping rows, which must agree with
+  // reading the new span from scratch
+  {
+    Variables<detail::cce_input_tags> advanced_coefficients_buffers =
+        coefficients_buffers_from_file;
+    size_t advanced_time_span_start = time_span_start;
+    size_t advanced_time_span_end = time_span_end;
+    buffer_updater.update_buffers_for_time(
+        make_not_null(&advanced_coefficients_buffers),
+        make_not_null(&advanced_time_span_start),
+        make_not_null(&advanced_time_span_end), target_time + 0.55, l_max,
+        interpolator_length, buffer_size);
+    CHECK(advanced_time_span_start > time_span_start);
+    CHECK(advanced_time_span_start < time_span_end);
+
+    Variables<detail::cce_input_tags> fresh_coefficients_buffers{
+        (buffer_size + 2 * interpolator_length) * square(l_max + 1)};
+    size_t fresh_time_span_start = 0;
+    size_t fresh_time_span_end = 0;
+    SpecWorldtubeH5BufferUpdater{filename}.update_buffers_for_time(
+        make_not_null(&fresh_coefficients_buffers),
+        make_not_null(&fresh_time_span_start),
+        make_not_null(&fresh_time_span_end), target_time + 0.55, l_max,
+        interpolator_length, buffer_size);
+    CHECK(advanced_time_span_start == fresh_time_span_start);
+    CHECK(advanced_time_span_end == fresh_time_span_end);
+    CHECK(advanced_coefficients_buffers == fresh_coefficients_buffers);
+  }
+
   if (file_system::check_if_file_exists(filename)) {
     file_system::rm(filename, true);
   }
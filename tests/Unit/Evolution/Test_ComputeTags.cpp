@@ -20,6 +20,8 @@
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/WrappedGr.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Time/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -41,6 +43,20 @@ struct AnalyticSolutionTag : db::SimpleTag {
   using type = AnalyticSolution;
 };
 
+struct TimeIndependentAnalyticSolution {
+  static constexpr bool is_time_independent = true;
+  static tuples::TaggedTuple<FieldTag> variables(
+      const tnsr::I<DataVector, 1>& x, const double /*t*/,
+      const tmpl::list<FieldTag> /*meta*/) noexcept {
+    return {Scalar<DataVector>{square(get<0>(x))}};
+  }
+  void pup(PUP::er& /*p*/) noexcept {}  // NOLINT
+};
+
+struct TimeIndependentAnalyticSolutionTag : db::SimpleTag {
+  using type = TimeIndependentAnalyticSolution;
+};
+
 }  // namespace
 SPECTRE_TEST_CASE("Unit.Evolution.ComputeTags", "[Unit][Evolution]") {
   tnsr::I<DataVector, 1, Frame::Inertial> inertial_coords{{{{1., 2., 3., 4.}}}};
@@ -57,6 +73,36 @@ SPECTRE_TEST_CASE("Unit.Evolution.ComputeTags", "[Unit][Evolution]") {
   TestHelpers::db::test_compute_tag<evolution::Tags::AnalyticCompute<
       1, AnalyticSolutionTag, tmpl::list<FieldTag>>>(
       "Analytic(Variables(Analytic(FieldTag)))");
+
+  // A time-independent solution is only recomputed when the coordinates change
+  using time_independent_compute_tag = evolution::Tags::AnalyticCompute<
+      1, TimeIndependentAnalyticSolutionTag, tmpl::list<FieldTag>>;
+  static_assert(not tmpl::list_contains_v<
+                    time_independent_compute_tag::argument_tags, Tags::Time>,
+                "The analytic solution of a time-independent solution should "
+                "not depend on the time.");
+  auto time_independent_box = db::create<
+      db::AddSimpleTags<domain::Tags::Coordinates<1, Frame::Inertial>,
+                        TimeIndependentAnalyticSolutionTag, Tags::Time>,
+      db::AddComputeTags<time_independent_compute_tag>>(
+      tnsr::I<DataVector, 1, Frame::Inertial>{{{{1., 2., 3., 4.}}}},
+      TimeIndependentAnalyticSolution{}, current_time);
+  CHECK_ITERABLE_APPROX(
+      get(get<::Tags::Analytic<FieldTag>>(time_independent_box)),
+      (DataVector{1., 4., 9., 16.}));
+  db::mutate<Tags::Time>(
+      make_not_null(&time_independent_box),
+      [](const gsl::not_null<double*> time) noexcept { *time = 3.; });
+  CHECK_ITERABLE_APPROX(
+      get(get<::Tags::Analytic<FieldTag>>(time_independent_box)),
+      (DataVector{1., 4., 9., 16.}));
+  db::mutate<domain::Tags::Coordinates<1, Frame::Inertial>>(
+      make_not_null(&time_independent_box),
+      [](const gsl::not_null<tnsr::I<DataVector, 1, Frame::Inertial>*>
+             coords) noexcept { get<0>(*coords) = 2.; });
+  CHECK_ITERABLE_APPROX(
+      get(get<::Tags::Analytic<FieldTag>>(time_independent_box)),
+      (DataVector{4., 4., 4., 4.}));
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.ComputeTags.Errors",
@@ -30,4 +30,27 @@ static_assert(evolution::is_analytic_data<SolutionDependentAnalyticData>::value,
 static_assert(
     not evolution::is_analytic_solution<SolutionDependentAnalyticData>::value,
     "Failed testing evolution::is_solution_data");
+
+struct TimeIndependentSolution : public MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = true;
+};
+struct ExplicitlyTimeDependentSolution : public MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = false;
+};
+struct TimeIndependentSolutionDependentAnalyticData
+    : public MarkAsAnalyticData,
+      private TimeIndependentSolution {};
+
+static_assert(
+    evolution::is_time_independent_solution_v<TimeIndependentSolution>,
+    "Failed testing evolution::is_time_independent_solution_v");
+static_assert(not evolution::is_time_independent_solution_v<Solution>,
+              "Failed testing evolution::is_time_independent_solution_v");
+static_assert(
+    not evolution::is_time_independent_solution_v<
+        ExplicitlyTimeDependentSolution>,
+    "Failed testing evolution::is_time_independent_solution_v");
+static_assert(not evolution::is_time_independent_solution_v<
+                  TimeIndependentSolutionDependentAnalyticData>,
+              "Failed testing evolution::is_time_independent_solution_v");
 }  // namespace
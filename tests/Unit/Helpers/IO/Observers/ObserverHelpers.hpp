@@ -78,8 +78,10 @@ struct observer_writer_component {
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = size_t;
-  using const_global_cache_tags = tmpl::list<observers::Tags::ReductionFileName,
-                                             observers::Tags::VolumeFileName>;
+  using const_global_cache_tags =
+      tmpl::list<observers::Tags::ReductionFileName,
+                 observers::Tags::VolumeFileName,
+                 observers::Tags::ReductionBufferSize>;
 
   using component_being_mocked = observers::ObserverWriter<Metavariables>;
   using simple_tags =
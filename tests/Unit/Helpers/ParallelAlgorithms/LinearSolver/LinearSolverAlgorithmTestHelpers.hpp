@@ -313,7 +313,11 @@ struct ElementArray {
 };
 
 // After the algorithm completes we perform a cleanup phase that checks the
-// expected output file was written and deletes it.
+// expected output file was written and deletes it. The cleanup phase must not
+// directly follow the phase in which the reduction data is observed: the
+// `ObserverWriter` writes buffered reduction data at the start of each phase,
+// concurrently with the actions of that phase. Here the `TestResult` phase lies
+// in between, so all reduction data is on disk once it is complete.
 template <bool CheckExpectedOutput>
 struct CleanOutput {
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
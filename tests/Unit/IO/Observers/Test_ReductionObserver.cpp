@@ -46,11 +46,14 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
       helpers::element_component<metavariables, type_of_observation>;
 
   tuples::TaggedTuple<observers::Tags::ReductionFileName,
-                      observers::Tags::VolumeFileName>
+                      observers::Tags::VolumeFileName,
+                      observers::Tags::ReductionBufferSize>
       cache_data{};
   const auto& output_file_prefix =
       tuples::get<observers::Tags::ReductionFileName>(cache_data) =
           "./Unit.IO.Observers.ReductionObserver";
+  // Collect the reduced data in memory so writing it can be tested
+  tuples::get<observers::Tags::ReductionBufferSize>(cache_data) = 2;
   ActionTesting::MockRuntimeSystem<metavariables> runner{cache_data};
   ActionTesting::emplace_component<obs_component>(&runner, 0);
   ActionTesting::next_action<obs_component>(make_not_null(&runner), 0);
@@ -166,6 +169,19 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
     // Invoke the threaded action 'WriteReductionData' to write reduction data
     // to disk.
     runner.invoke_queued_threaded_action<obs_writer>(0);
+    // The reduced data is buffered until the buffer is full or it is written
+    // at the end of the phase.
+    CHECK_FALSE(file_system::check_if_file_exists(h5_file_name));
+    CHECK(ActionTesting::get_databox_tag<
+              obs_writer, observers::Tags::BufferedReductionData>(runner, 0)
+              .at("/element_data")
+              .second.size() == 1);
+    ActionTesting::threaded_action<
+        obs_writer, observers::ThreadedActions::WriteBufferedReductionData>(
+        make_not_null(&runner), 0);
+    CHECK(ActionTesting::get_databox_tag<
+              obs_writer, observers::Tags::BufferedReductionData>(runner, 0)
+              .empty());
 
     REQUIRE(file_system::check_if_file_exists(h5_file_name));
     // Check that the H5 file was written correctly.
@@ -23,6 +23,9 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<VolumeObserversContributed>(
       "VolumeObserversContributed");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
+  TestHelpers::db::test_simple_tag<BufferedReductionData>(
+      "BufferedReductionData");
+  TestHelpers::db::test_simple_tag<ReductionBufferSize>("ReductionBufferSize");
   TestHelpers::db::test_simple_tag<ReductionData<double>>("ReductionData");
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
@@ -53,7 +53,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
       helpers::element_component<metavariables, type_of_observation>;
 
   tuples::TaggedTuple<observers::Tags::ReductionFileName,
-                      observers::Tags::VolumeFileName>
+                      observers::Tags::VolumeFileName,
+                      observers::Tags::ReductionBufferSize>
       cache_data{};
   const auto& output_file_prefix =
       tuples::get<observers::Tags::VolumeFileName>(cache_data) =
@@ -52,7 +52,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.WriteSimpleData", "[Unit][Observers]") {
   using obs_writer = helpers::observer_writer_component<test_metavariables>;
 
   tuples::TaggedTuple<observers::Tags::ReductionFileName,
-                      observers::Tags::VolumeFileName>
+                      observers::Tags::VolumeFileName,
+                      observers::Tags::ReductionBufferSize>
       cache_data{};
   tuples::get<observers::Tags::VolumeFileName>(cache_data) =
       "./Unit.IO.Observers.WriteSimpleData";
@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/ExtractVolumeData.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+void remove_file(const std::string& file_name) noexcept {
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+// One grid per node, with data that identifies the node and the observation
+void write_node_file(const std::string& file_name, const size_t node,
+                     const std::vector<size_t>& observation_ids) noexcept {
+  remove_file(file_name);
+  h5::H5File<h5::AccessType::ReadWrite> file(file_name);
+  auto& volume_file = file.insert<h5::VolumeData>("/element_data", 2);
+  for (const size_t observation_id : observation_ids) {
+    const double value = static_cast<double>(observation_id);
+    const std::string grid = "[B" + std::to_string(node) + ",(L0I0,L0I0)]";
+    std::vector<TensorComponent> components{};
+    for (const std::string name : {"S", "T"}) {
+      components.emplace_back(
+          grid + "/" + name,
+          (name == "S" ? 1.0 : -1.0) *
+              DataVector{value, value + node, value + 2.0 * node});
+    }
+    volume_file.write_volume_data(
+        observation_id, value,
+        {{std::vector<size_t>{3}, std::move(components)}});
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.ExtractVolumeData", "[Unit][IO][H5]") {
+  const std::vector<std::string> node_file_names{
+      "Unit.IO.H5.ExtractVolumeData0.h5", "Unit.IO.H5.ExtractVolumeData1.h5"};
+  write_node_file(node_file_names[0], 0, {1, 2, 3});
+  // The second node wrote no data at the first observation
+  write_node_file(node_file_names[1], 1, {2, 3});
+  const std::string output_prefix = "Unit.IO.H5.ExtractVolumeData.Obs";
+
+  {
+    INFO("Merge all observations");
+    const auto output_file_names = h5::extract_volume_data(
+        node_file_names, "/element_data", output_prefix, {}, "", 0.0, 10.0);
+    CHECK(output_file_names ==
+          std::vector<std::string>{output_prefix + "0.h5",
+                                   output_prefix + "1.h5",
+                                   output_prefix + "2.h5"});
+    h5::H5File<h5::AccessType::ReadOnly> file(output_file_names[1]);
+    const auto& volume_file = file.get<h5::VolumeData>("/element_data");
+    CHECK(volume_file.get_version() == 2);
+    CHECK(volume_file.list_observation_ids() == std::vector<size_t>{2});
+    CHECK(volume_file.get_observation_value(2) == 2.0);
+    CHECK(volume_file.get_grid_names(2) ==
+          std::vector<std::string>{"[B0,(L0I0,L0I0)]", "[B1,(L0I0,L0I0)]"});
+    CHECK(volume_file.get_extents(2) ==
+          std::vector<std::vector<size_t>>{{3}, {3}});
+    CHECK(volume_file.get_tensor_component(2, "S") ==
+          DataVector{2.0, 2.0, 2.0, 2.0, 3.0, 4.0});
+    CHECK(volume_file.get_tensor_component(2, "T") ==
+          DataVector{-2.0, -2.0, -2.0, -2.0, -3.0, -4.0});
+
+    h5::H5File<h5::AccessType::ReadOnly> first_file(output_file_names[0]);
+    CHECK(first_file.get<h5::VolumeData>("/element_data")
+              .get_grid_names(1) ==
+          std::vector<std::string>{"[B0,(L0I0,L0I0)]"});
+  }
+
+  {
+    INFO("Extract components, grids and observations");
+    for (const size_t part : {0_st, 1_st}) {
+      CAPTURE(part);
+      const auto output_file_names = h5::extract_volume_data(
+          node_file_names, "/element_data", output_prefix, {"T"}, "[B1,",
+          1.5, 10.0, 2, part);
+      // Each part holds every other observation
+      CHECK(output_file_names == std::vector<std::string>{
+                                     output_prefix + std::to_string(part) +
+                                     ".h5"});
+      const size_t observation_id = part + 2;
+      const auto value = static_cast<double>(observation_id);
+      h5::H5File<h5::AccessType::ReadOnly> file(output_file_names[0]);
+      const auto& volume_file = file.get<h5::VolumeData>("/element_data");
+      CHECK(volume_file.list_observation_ids() ==
+            std::vector<size_t>{observation_id});
+      CHECK(volume_file.get_grid_names(observation_id) ==
+            std::vector<std::string>{"[B1,(L0I0,L0I0)]"});
+      CHECK(volume_file.list_tensor_components(observation_id) ==
+            std::vector<std::string>{"T"});
+      CHECK(volume_file.get_tensor_component(observation_id, "T") ==
+            DataVector{-value, -value - 1.0, -value - 2.0});
+    }
+  }
+
+  for (const auto& file_name : node_file_names) {
+    remove_file(file_name);
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    remove_file(output_prefix + std::to_string(i) + ".h5");
+  }
+}
+
+// [[OutputRegex, No tensor component 'U' found in]]
+SPECTRE_TEST_CASE("Unit.IO.H5.ExtractVolumeData.MissingComponent",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string file_name =
+      "Unit.IO.H5.ExtractVolumeData.MissingComponent.h5";
+  write_node_file(file_name, 0, {1});
+  h5::extract_volume_data({file_name}, "/element_data",
+                          "Unit.IO.H5.ExtractVolumeData.MissingComponent.Obs",
+                          {"U"}, "", 0.0, 10.0);
+}
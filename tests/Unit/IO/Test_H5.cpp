@@ -370,6 +370,22 @@ SPECTRE_TEST_CASE("Unit.IO.H5.Dat", "[Unit][IO][H5]") {
     }();
     CHECK(subset == answer);
   }
+  {
+    const auto subset = error_file.get_data_subset({3, 0, 1, 3}, 1, 2);
+    const Matrix answer = []() {
+      Matrix result(2, 4);
+      result(0, 0) = 0.6;
+      result(0, 1) = 0.11;
+      result(0, 2) = 0.4;
+      result(0, 3) = 0.6;
+      result(1, 0) = 0.8;
+      result(1, 1) = 0.22;
+      result(1, 2) = 0.55;
+      result(1, 3) = 0.8;
+      return result;
+    }();
+    CHECK(subset == answer);
+  }
   {
     const auto subset = error_file.get_data_subset({}, 0, 2);
     const Matrix answer(2, 0, 0.0);
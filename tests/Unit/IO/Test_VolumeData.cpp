@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -235,6 +236,43 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
     CHECK(last_grid_offset_and_length.second == 8);
   }
 
+  {
+    INFO("Read a subset of the grids");
+    const size_t observation_id = observation_ids.front();
+    DataVector all_data = volume_file.get_tensor_component(observation_id, "S");
+    // Non-owning views of the data of each grid
+    const DataVector first_grid_data(all_data.data(), 8);
+    const DataVector last_grid_data(all_data.data() + 8, 8);  // NOLINT
+    CHECK(volume_file.get_tensor_component(observation_id, "S",
+                                           {grid_names.back()}) ==
+          last_grid_data);
+    CHECK(volume_file.get_tensor_component(observation_id, "S", grid_names) ==
+          all_data);
+    // The grids are returned in the requested order
+    DataVector reordered_data(16);
+    std::copy(last_grid_data.begin(), last_grid_data.end(),
+              reordered_data.begin());
+    std::copy(first_grid_data.begin(), first_grid_data.end(),
+              reordered_data.begin() + 8);
+    CHECK(volume_file.get_tensor_component(
+              observation_id, "S", {grid_names.back(), grid_names.front()}) ==
+          reordered_data);
+    CHECK(volume_file
+              .get_tensor_component(observation_id, "S",
+                                    std::vector<std::string>{})
+              .size() == 0);
+    // Reading at precomputed offsets and lengths gives the same data
+    const std::vector<std::pair<size_t, size_t>> offsets_and_lengths{
+        {8, 8}, {0, 8}};
+    CHECK(volume_file.get_tensor_component(observation_id, "S",
+                                           offsets_and_lengths) ==
+          reordered_data);
+    CHECK(volume_file
+              .get_tensor_component(observation_id, "S",
+                                    std::vector<std::pair<size_t, size_t>>{})
+              .size() == 0);
+  }
+
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
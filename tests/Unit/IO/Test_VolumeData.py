@@ -142,6 +142,26 @@ class TestVolumeData(unittest.TestCase):
                         tensor_component=expected_tensor_component_names[i]))
                 [0:8], expected_tensor_component_data)
 
+    # Test that a subset of the grids is read in the requested order
+    def test_tensor_component_of_grids(self):
+        obs_id = 0
+        # field_1 on grid_2 was written from the second row of data
+        npt.assert_almost_equal(
+            np.asarray(
+                self.vol_file.get_tensor_component(observation_id=obs_id,
+                                                   tensor_component='field_1',
+                                                   grid_names=['grid_2'])),
+            self.tensor_component_data[1])
+        npt.assert_almost_equal(
+            np.asarray(
+                self.vol_file.get_tensor_component(
+                    observation_id=obs_id,
+                    tensor_component='field_1',
+                    grid_names=['grid_2', 'grid_1'])),
+            np.concatenate(
+                [self.tensor_component_data[1],
+                 self.tensor_component_data[0]]))
+
     # Test that the offset and length for certain grid is retrieved correctly
     def test_offset_and_length_for_grid(self):
         obs_id = self.vol_file.list_observation_ids()[0]
@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataFiles.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+void remove_file(const std::string& file_name) noexcept {
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+void write_file(const std::string& file_name,
+                const std::vector<size_t>& observation_ids) noexcept {
+  remove_file(file_name);
+  h5::H5File<h5::AccessType::ReadWrite> file(file_name);
+  auto& volume_file = file.insert<h5::VolumeData>("/element_data", 0);
+  for (const size_t observation_id : observation_ids) {
+    // the observation values are ordered opposite to the ids
+    const double value = 10.0 - static_cast<double>(observation_id);
+    volume_file.write_volume_data(
+        observation_id, value,
+        {{std::vector<size_t>{1},
+          {TensorComponent{"[B0,(L0I0)]/S", DataVector{value}}}}});
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeDataFiles", "[Unit][IO][H5]") {
+  const std::vector<std::string> file_names{"Unit.IO.H5.VolumeDataFiles0.h5",
+                                            "Unit.IO.H5.VolumeDataFiles1.h5"};
+  write_file(file_names[0], {1, 2, 3});
+  write_file(file_names[1], {3, 4});
+
+  {
+    const h5::VolumeDataFiles volume_files(file_names, "/element_data");
+    CHECK(volume_files.size() == 2);
+    CHECK(volume_files.has_observation(0, 1));
+    CHECK_FALSE(volume_files.has_observation(0, 4));
+    CHECK(volume_files.has_observation(1, 3));
+    CHECK_FALSE(volume_files.has_observation(1, 2));
+    CHECK(volume_files.volume_file(1).get_observation_value(4) == 6.0);
+    CHECK(volume_files.observations(0.0, 10.0) ==
+          std::vector<std::pair<double, size_t>>{
+              {6.0, 4}, {7.0, 3}, {8.0, 2}, {9.0, 1}});
+    CHECK(volume_files.observations(7.0, 8.5) ==
+          std::vector<std::pair<double, size_t>>{{7.0, 3}, {8.0, 2}});
+    CHECK(volume_files.observations(20.0, 30.0).empty());
+  }
+
+  for (const auto& file_name : file_names) {
+    remove_file(file_name);
+  }
+}
@@ -0,0 +1,208 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/Xdmf.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+std::string read_file(const std::string& file_name) noexcept {
+  std::ifstream file(file_name);
+  std::stringstream contents{};
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+bool contains(const std::string& text, const std::string& substring) noexcept {
+  return text.find(substring) != std::string::npos;
+}
+
+std::vector<ExtentsAndTensorVolumeData> make_elements(
+    const double observation_value) noexcept {
+  std::vector<ExtentsAndTensorVolumeData> elements{};
+  for (const std::string grid : {"[[2,3,4]]", "[[5,6,7]]"}) {
+    std::vector<TensorComponent> components{};
+    for (const std::string name :
+         {"InertialCoordinates_x", "InertialCoordinates_y",
+          "InertialCoordinates_z", "S", "V_x", "V_y", "V_z"}) {
+      components.emplace_back(
+          grid + "/" + name,
+          observation_value *
+              DataVector{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0});
+    }
+    elements.emplace_back(std::vector<size_t>{2, 2, 2}, std::move(components));
+  }
+  return elements;
+}
+
+void test_grid() noexcept {
+  const std::string grid = h5::xdmf_grid(
+      "Volume0.h5", "/element_data", 8, {{2, 3}, {4, 4}},
+      {"InertialCoordinates_x", "InertialCoordinates_y", "S", "V_x", "V_y"},
+      "InertialCoordinates");
+  // 1 * 2 + 3 * 3 cells and 2 * 3 + 4 * 4 points
+  CHECK(contains(grid, "<Topology TopologyType=\"Quadrilateral\" "
+                       "NumberOfElements=\"11\">"));
+  CHECK(contains(grid, "<DataItem Dimensions=\"11 4\""));
+  CHECK(contains(grid, "<DataItem Dimensions=\" 22\""));
+  CHECK(contains(grid,
+                 "Volume0.h5:/element_data.vol/ObservationId8/connectivity"));
+  CHECK(contains(grid, "<Geometry Type=\"X_Y\">"));
+  CHECK(contains(grid, "<Attribute Name=\"S\" AttributeType=\"Scalar\""));
+  CHECK(contains(grid, "<Attribute Name=\"V\" AttributeType=\"Vector\""));
+  CHECK(contains(grid, "JOIN($0,$1, 0 * $1)"));
+  CHECK(not contains(grid, "Name=\"V_y\""));
+  CHECK(not contains(grid, "Name=\"InertialCoordinates"));
+}
+
+void test_grid_with_single_point_dimensions() noexcept {
+  // Slices of 3D data are described by quadrilaterals
+  const std::string slice_grid = h5::xdmf_grid(
+      "Volume0.h5", "/slice_data", 8, {{4, 1, 3}, {1, 2, 5}},
+      {"InertialCoordinates_x", "InertialCoordinates_y",
+       "InertialCoordinates_z", "S"},
+      "InertialCoordinates");
+  // 3 * 2 + 1 * 4 cells and 4 * 3 + 2 * 5 points
+  CHECK(contains(slice_grid, "<Topology TopologyType=\"Quadrilateral\" "
+                             "NumberOfElements=\"10\">"));
+  CHECK(contains(slice_grid, "<DataItem Dimensions=\"10 4\""));
+  CHECK(contains(slice_grid, "<DataItem Dimensions=\" 22\""));
+  CHECK(contains(slice_grid, "<Geometry Type=\"X_Y_Z\">"));
+  CHECK(contains(slice_grid,
+                 "Volume0.h5:/slice_data.vol/ObservationId8/connectivity"));
+
+  // and slices of 2D data by lines
+  const std::string line_grid = h5::xdmf_grid(
+      "Volume0.h5", "/slice_data", 8, {{4, 1}, {1, 3}},
+      {"InertialCoordinates_x", "InertialCoordinates_y", "S"},
+      "InertialCoordinates");
+  CHECK(contains(line_grid, "<Topology TopologyType=\"Polyline\" "
+                            "NodesPerElement=\"2\" NumberOfElements=\"5\">"));
+  CHECK(contains(line_grid, "<DataItem Dimensions=\"5 2\""));
+  CHECK(contains(line_grid, "<DataItem Dimensions=\" 7\""));
+  CHECK(contains(line_grid, "<Geometry Type=\"X_Y\">"));
+}
+
+void test_files() noexcept {
+  const std::string h5_file_name = "Unit.IO.H5.Xdmf.h5";
+  const std::string appended_xdmf_file_name = "Unit.IO.H5.Xdmf.Appended.xmf";
+  const std::string other_h5_file_name = "Unit.IO.H5.Xdmf.Other.h5";
+  const std::string xdmf_file_name = "Unit.IO.H5.Xdmf.xmf";
+  for (const auto& file_name : {h5_file_name, other_h5_file_name,
+                                appended_xdmf_file_name, xdmf_file_name}) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+
+  const std::vector<size_t> observation_ids{4, 8, 2};
+  const std::vector<double> observation_values{1.0, 2.0, 0.5};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& volume_file = h5_file.insert<h5::VolumeData>("/element_data");
+    for (size_t i = 0; i < observation_ids.size(); ++i) {
+      volume_file.write_volume_data(observation_ids[i], observation_values[i],
+                                    make_elements(observation_values[i]));
+    }
+  }
+
+  // Append the observations in time order, as they are written during a run
+  std::vector<std::string> grids(observation_ids.size());
+  {
+    h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+    const auto& volume_file = h5_file.get<h5::VolumeData>("/element_data");
+    for (const size_t i : std::vector<size_t>{2, 0, 1}) {
+      grids[i] = h5::xdmf_grid(
+          h5_file_name, "/element_data", observation_ids[i],
+          volume_file.get_extents(observation_ids[i]),
+          volume_file.list_tensor_components(observation_ids[i]),
+          "InertialCoordinates");
+      h5::append_to_xdmf_file(appended_xdmf_file_name, observation_values[i],
+                              grids[i]);
+    }
+  }
+  const std::string appended_xdmf = read_file(appended_xdmf_file_name);
+  CHECK(contains(appended_xdmf, "<Time Value=\"5.00000000000000e-01\"/>"));
+  CHECK(contains(appended_xdmf, "<Time Value=\"2.00000000000000e+00\"/>"));
+  CHECK(contains(appended_xdmf, grids[0]));
+  CHECK(contains(appended_xdmf,
+                 "<Topology TopologyType=\"Hexahedron\" "
+                 "NumberOfElements=\"2\">"));
+  CHECK(contains(appended_xdmf, "JOIN($0,$1,$2)"));
+  CHECK(appended_xdmf.substr(appended_xdmf.size() - 26) ==
+        "</Grid>\n</Domain>\n</Xdmf>\n");
+
+  // Regenerating the file from the H5 file gives the same result
+  h5::write_xdmf_file(xdmf_file_name, {h5_file_name}, "/element_data",
+                      "InertialCoordinates", 0.0, 1.0e300, 1);
+  CHECK(read_file(xdmf_file_name) == appended_xdmf);
+
+  // Select observations by time and stride
+  h5::write_xdmf_file(xdmf_file_name, {h5_file_name}, "/element_data",
+                      "InertialCoordinates", 0.7, 1.0e300, 2);
+  const std::string selected_xdmf = read_file(xdmf_file_name);
+  CHECK(not contains(selected_xdmf, grids[2]));
+  CHECK(contains(selected_xdmf, grids[0]));
+  CHECK(not contains(selected_xdmf, grids[1]));
+
+  // Observations that are not in the first file are included
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(other_h5_file_name);
+    h5_file.insert<h5::VolumeData>("/element_data")
+        .write_volume_data(16, 3.0, make_elements(3.0));
+  }
+  h5::write_xdmf_file(xdmf_file_name, {h5_file_name, other_h5_file_name},
+                      "/element_data", "InertialCoordinates", 0.0, 1.0e300, 1);
+  const std::string combined_xdmf = read_file(xdmf_file_name);
+  CHECK(contains(combined_xdmf, grids[2]));
+  CHECK(contains(combined_xdmf, "<Time Value=\"3.00000000000000e+00\"/>"));
+  CHECK(contains(combined_xdmf, other_h5_file_name +
+                                    ":/element_data.vol/ObservationId16/"));
+
+  for (const auto& file_name : {h5_file_name, other_h5_file_name,
+                                appended_xdmf_file_name, xdmf_file_name}) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.Xdmf", "[Unit][IO][H5]") {
+  test_grid();
+  test_grid_with_single_point_dimensions();
+  test_files();
+}
+
+// [[OutputRegex, must have more than one point in the same number of
+// dimensions]]
+SPECTRE_TEST_CASE("Unit.IO.H5.Xdmf.MixedDimensions", "[Unit][IO][H5]") {
+  ERROR_TEST();
+  h5::xdmf_grid("Volume0.h5", "/slice_data", 8, {{4, 1, 3}, {4, 1, 1}},
+                {"InertialCoordinates_x", "InertialCoordinates_y",
+                 "InertialCoordinates_z"},
+                "InertialCoordinates");
+}
+
+// [[OutputRegex, does not end with a temporal collection]]
+SPECTRE_TEST_CASE("Unit.IO.H5.Xdmf.NotXdmf", "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string file_name = "Unit.IO.H5.Xdmf.NotXdmf.xmf";
+  {
+    std::ofstream file(file_name);
+    file << "This is not an XDMF file written by h5::append_to_xdmf_file\n";
+  }
+  h5::append_to_xdmf_file(file_name, 1.0, "");
+}
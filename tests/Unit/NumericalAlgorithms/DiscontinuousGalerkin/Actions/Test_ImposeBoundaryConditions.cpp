@@ -21,6 +21,7 @@
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ImposeBoundaryConditions.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/AnalyticSolutions/AnalyticSolution.hpp"
 #include "Time/Tags.hpp"
@@ -163,10 +164,127 @@ void run_test() {
   CHECK(external_vars == expected_vars);
 }
 
+
+// A time-independent boundary condition that counts how often it is evaluated
+struct TimeIndependentBoundaryCondition : MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = true;
+  static size_t number_of_evaluations;
+
+  static tuples::TaggedTuple<Var> variables(
+      const tnsr::I<DataVector, Dim>& x, double /*t*/,
+      tmpl::list<Var> /*meta*/) noexcept {
+    ++number_of_evaluations;
+    return tuples::TaggedTuple<Var>{Scalar<DataVector>{10. * get<0>(x)}};
+  }
+  // clang-tidy: do not use references
+  void pup(PUP::er& /*p*/) noexcept {}  // NOLINT
+};
+
+size_t TimeIndependentBoundaryCondition::number_of_evaluations = 0;
+
+struct TimeIndependentBoundaryConditionTag {
+  using type = TimeIndependentBoundaryCondition;
+};
+
+using exterior_bdry_coords_tag =
+    domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<Dim>,
+                            domain::Tags::Coordinates<Dim, Frame::Inertial>>;
+using caching_simple_tags =
+    db::AddSimpleTags<Tags::Time, exterior_bdry_coords_tag,
+                      exterior_bdry_vars_tag,
+                      Tags::DirichletBoundaryDataCoordinates<Dim>>;
+
+template <typename Metavariables>
+struct caching_component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags =
+      tmpl::list<TimeIndependentBoundaryConditionTag>;
+
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<caching_simple_tags>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<
+              dg::Actions::ImposeDirichletBoundaryConditions<Metavariables>,
+              dg::Actions::ImposeDirichletBoundaryConditions<Metavariables>,
+              dg::Actions::ImposeDirichletBoundaryConditions<Metavariables>>>>;
+};
+
+struct CachingMetavariables {
+  using system = System<false>;
+  using component_list = tmpl::list<caching_component<CachingMetavariables>>;
+
+  using boundary_condition_tag = TimeIndependentBoundaryConditionTag;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+void test_time_independent_boundary_condition() noexcept {
+  using my_component = caching_component<CachingMetavariables>;
+  const auto external_directions = {Direction<2>::lower_eta(),
+                                    Direction<2>::upper_xi()};
+
+  ActionTesting::MockRuntimeSystem<CachingMetavariables> runner{
+      {TimeIndependentBoundaryCondition{}}};
+  {
+    const tnsr::I<DataVector, Dim> coords{DataVector{1., 2., 3.}};
+    db::item_type<exterior_bdry_coords_tag> external_bdry_coords{
+        {{Direction<2>::lower_eta(), coords},
+         {Direction<2>::upper_xi(), coords}}};
+    db::item_type<exterior_bdry_vars_tag> exterior_bdry_vars;
+    for (const auto& direction : external_directions) {
+      exterior_bdry_vars[direction].initialize(3);
+    }
+    ActionTesting::emplace_component_and_initialize<my_component>(
+        &runner, 0,
+        {1.2, std::move(external_bdry_coords), std::move(exterior_bdry_vars),
+         db::item_type<Tags::DirichletBoundaryDataCoordinates<Dim>>{}});
+  }
+  ActionTesting::set_phase(make_not_null(&runner),
+                           CachingMetavariables::Phase::Testing);
+  auto& box = ActionTesting::get_databox<my_component, caching_simple_tags>(
+      make_not_null(&runner), 0);
+  const auto check_vars = [&box](const Direction<2>& direction,
+                                 const DataVector& expected) noexcept {
+    CHECK(get(get<Var>(db::get<exterior_bdry_vars_tag>(box).at(direction))) ==
+          expected);
+  };
+
+  TimeIndependentBoundaryCondition::number_of_evaluations = 0;
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+  CHECK(TimeIndependentBoundaryCondition::number_of_evaluations == 2);
+  check_vars(Direction<2>::lower_eta(), DataVector{10., 20., 30.});
+  check_vars(Direction<2>::upper_xi(), DataVector{10., 20., 30.});
+
+  // Changing only the time doesn't recompute the boundary data
+  db::mutate<Tags::Time>(make_not_null(&box),
+                         [](const gsl::not_null<double*> time) noexcept {
+                           *time = 2.4;
+                         });
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+  CHECK(TimeIndependentBoundaryCondition::number_of_evaluations == 2);
+  check_vars(Direction<2>::upper_xi(), DataVector{10., 20., 30.});
+
+  // Moving one face recomputes the boundary data on that face only
+  db::mutate<exterior_bdry_coords_tag>(
+      make_not_null(&box),
+      [](const gsl::not_null<db::item_type<exterior_bdry_coords_tag>*>
+             coords) noexcept {
+        get<0>(coords->at(Direction<2>::upper_xi())) = 4.;
+      });
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+  CHECK(TimeIndependentBoundaryCondition::number_of_evaluations == 3);
+  check_vars(Direction<2>::lower_eta(), DataVector{10., 20., 30.});
+  check_vars(Direction<2>::upper_xi(), DataVector{40., 40., 40.});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.Actions.BoundaryConditions",
                   "[Unit][NumericalAlgorithms][Actions]") {
   run_test<false>();
   run_test<true>();
+  test_time_independent_boundary_condition();
 }
@@ -7,10 +7,15 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <deque>
+#include <utility>
 #include <vector>
 
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
+#include "ApparentHorizons/Tags.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
@@ -48,6 +53,35 @@ struct MockMetavariables {
                  InterpTargetTestHelpers::mock_interpolator<MockMetavariables>>;
   enum class Phase { Initialization, Testing, Exit };
 };
+
+void test_prepare_points() noexcept {
+  using target_points =
+      MockMetavariables::InterpolationTargetA::compute_target_points;
+  using strahlkorper_tag = StrahlkorperTags::Strahlkorper<Frame::Inertial>;
+  using previous_strahlkorpers_tag =
+      ah::Tags::PreviousStrahlkorpers<Frame::Inertial>;
+  const Strahlkorper<Frame::Inertial> strahlkorper(6, 2.0, {{0.0, 0.0, 0.0}});
+
+  // Without previous horizons the Strahlkorper is kept
+  auto box = db::create<db::AddSimpleTags<strahlkorper_tag, ah::Tags::FastFlow,
+                                          previous_strahlkorpers_tag>>(
+      strahlkorper, FastFlow{}, db::item_type<previous_strahlkorpers_tag>{});
+  target_points::prepare_points(make_not_null(&box), 2.0);
+  CHECK(db::get<strahlkorper_tag>(box) == strahlkorper);
+
+  // A new find starts from the extrapolated previous horizons
+  const db::item_type<previous_strahlkorpers_tag> previous_strahlkorpers{
+      {1.0, Strahlkorper<Frame::Inertial>(6, 1.5, {{0.0, 0.0, 0.0}})},
+      {0.5, Strahlkorper<Frame::Inertial>(6, 1.0, {{0.0, 0.0, 0.0}})}};
+  db::mutate<previous_strahlkorpers_tag>(
+      make_not_null(&box),
+      [&previous_strahlkorpers](
+          const gsl::not_null<db::item_type<previous_strahlkorpers_tag>*>
+              previous) noexcept { *previous = previous_strahlkorpers; });
+  target_points::prepare_points(make_not_null(&box), 2.0);
+  CHECK(db::get<strahlkorper_tag>(box) ==
+        ah::extrapolate_strahlkorper(previous_strahlkorpers, 2.0));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE(
@@ -123,4 +157,6 @@ SPECTRE_TEST_CASE(
                                    Frame::Inertial>>(
       domain_creator, std::move(apparent_horizon_opts),
       expected_block_coord_holders);
+
+  test_prepare_points();
 }
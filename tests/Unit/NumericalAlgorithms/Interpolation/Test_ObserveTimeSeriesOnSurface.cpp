@@ -117,7 +117,8 @@ struct MockObserverWriter {
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = size_t;
   using const_global_cache_tags =
-      tmpl::list<observers::Tags::ReductionFileName>;
+      tmpl::list<observers::Tags::ReductionFileName,
+                 observers::Tags::ReductionBufferSize>;
   using simple_tags =
       typename observers::Actions::InitializeWriter<Metavariables>::simple_tags;
   using compute_tags = typename observers::Actions::InitializeWriter<
@@ -297,11 +298,12 @@ SPECTRE_TEST_CASE(
   const auto domain_creator =
       domain::creators::Shell(0.9, 4.9, 1, {{5, 5}}, false);
   tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                      observers::Tags::ReductionBufferSize,
                       ::intrp::Tags::KerrHorizon<metavars::SurfaceA>,
                       domain::Tags::Domain<3>,
                       ::intrp::Tags::KerrHorizon<metavars::SurfaceB>,
                       ::intrp::Tags::KerrHorizon<metavars::SurfaceC>>
-      tuple_of_opts{h5_file_prefix, kerr_horizon_opts_A,
+      tuple_of_opts{h5_file_prefix, 0_st, kerr_horizon_opts_A,
                     domain_creator.create_domain(), kerr_horizon_opts_B,
                     kerr_horizon_opts_C};
 
@@ -433,6 +435,11 @@ SPECTRE_TEST_CASE(
   ActionTesting::invoke_queued_threaded_action<obs_writer>(
       make_not_null(&runner), 0);
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  // Write the buffered reduction data to disk, as is done at the end of the
+  // phase.
+  ActionTesting::threaded_action<
+      obs_writer, observers::ThreadedActions::WriteBufferedReductionData>(
+      make_not_null(&runner), 0);
 
   // By hand compute integral(r^2 d(cos theta) dphi (2x+3y+5z)^2)
   const std::vector<double> expected_integral_a{2432.0 * M_PI / 3.0};
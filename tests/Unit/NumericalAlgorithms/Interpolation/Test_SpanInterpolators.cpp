@@ -3,6 +3,8 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <boost/math/interpolators/barycentric_rational.hpp>
+#include <complex>
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
@@ -82,10 +84,57 @@ void test_interpolator_approximate_fidelity(
                               interpolator_approx);
 }
 
+template <typename Generator>
+void test_barycentric_against_boost(
+    const gsl::not_null<Generator*> gen) noexcept {
+  UniformCustomDistribution<double> value_dist{0.1, 1.0};
+  const size_t number_of_points = 8;
+  DataVector points{number_of_points};
+  for (size_t i = 0; i < number_of_points; ++i) {
+    points[i] = 0.1 * static_cast<double>(i) + 0.05 * value_dist(*gen);
+  }
+  const auto complex_values = make_with_random_values<ComplexDataVector>(
+      gen, value_dist, number_of_points);
+  const DataVector real_values = real(complex_values);
+  const DataVector imag_values = imag(complex_values);
+  const double target_point = 0.7 * value_dist(*gen);
+
+  // call through the base class to check that the complex specialization is
+  // dispatched virtually
+  const BarycentricRationalSpanInterpolator barycentric{3u, 5u};
+  const SpanInterpolator& interpolator = barycentric;
+  const gsl::span<const double> points_span{points.data(), points.size()};
+  const double real_result = interpolator.interpolate(
+      points_span,
+      gsl::span<const double>{real_values.data(), number_of_points},
+      target_point);
+  const std::complex<double> complex_result = interpolator.interpolate(
+      points_span,
+      gsl::span<const std::complex<double>>{complex_values.data(),
+                                            number_of_points},
+      target_point);
+
+  const boost::math::barycentric_rational<double> boost_real{
+      points.data(), real_values.data(), number_of_points, 5};
+  const boost::math::barycentric_rational<double> boost_imag{
+      points.data(), imag_values.data(), number_of_points, 5};
+  CHECK(real_result == approx(boost_real(target_point)));
+  CHECK(real(complex_result) == approx(boost_real(target_point)));
+  CHECK(imag(complex_result) == approx(boost_imag(target_point)));
+
+  // source points are reproduced exactly
+  CHECK(interpolator.interpolate(
+            points_span,
+            gsl::span<const std::complex<double>>{complex_values.data(),
+                                                  number_of_points},
+            points[3]) == complex_values[3]);
+}
+
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolation.SpanInterpolators",
                   "[Unit][NumericalAlgorithms]") {
   MAKE_GENERATOR(gen);
   test_linear_interpolator(make_not_null(&gen));
+  test_barycentric_against_boost(make_not_null(&gen));
 
   {
     // Linear interpolator will not get terribly close, but that's okay.
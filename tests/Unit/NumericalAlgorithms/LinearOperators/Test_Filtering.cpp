@@ -6,10 +6,12 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <string>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Matrix.hpp"
@@ -25,13 +27,21 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/RungeKutta3.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 // IWYU pragma: no_forward_declare ActionTesting::InitializeDataBox
 // IWYU pragma: no_forward_declare dg::Actions::ExponentialFilter
 
+class TimeStepper;
+
 namespace {
 namespace Tags {
 struct ScalarVar : db::SimpleTag {
@@ -91,6 +101,40 @@ struct Metavariables {
   enum class Phase { Initialization, Testing, Exit };
 };
 
+template <typename Metavariables>
+struct FusedComponent {
+  using metavariables = Metavariables;
+  static constexpr size_t dim = metavariables::system::volume_dim;
+  using variables_tag = typename metavariables::system::variables_tag;
+
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags =
+      tmpl::list<::Tags::TimeStepper<TimeStepper>>;
+  using simple_tags =
+      db::AddSimpleTags<domain::Tags::Mesh<dim>, ::Tags::TimeStep,
+                        variables_tag,
+                        ::Tags::HistoryEvolvedVariables<variables_tag>>;
+
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<dg::Actions::UpdateUAndFilter<
+              Filters::Exponential<0>,
+              typename metavariables::tags_to_filter>>>>;
+};
+
+template <size_t Dim, typename TagsToFilter>
+struct FusedMetavariables {
+  using system = System<Dim>;
+  using tags_to_filter = TagsToFilter;
+  using component_list = tmpl::list<FusedComponent<FusedMetavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
 template <typename Metavariables,
           Requires<Metavariables::filter_individually> = nullptr>
 typename ActionTesting::MockRuntimeSystem<Metavariables>::CacheTuple
@@ -216,6 +260,97 @@ void invoke_test_exponential_filter_action(
                                                      disable_for_debugging);
 }
 
+template <size_t Dim, typename TagsToFilter>
+void test_update_u_and_filter(const double alpha,
+                              const unsigned half_power) noexcept {
+  Approx custom_approx = Approx::custom().epsilon(5.0e-13);
+
+  using metavariables = FusedMetavariables<Dim, TagsToFilter>;
+  using component = FusedComponent<metavariables>;
+  using variables_tag = typename metavariables::system::variables_tag;
+  using dt_variables_tag = db::add_tag_prefix<::Tags::dt, variables_tag>;
+
+  const Mesh<Dim> mesh(5, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto);
+  const Slab slab(0.0, 1.0);
+  const TimeDelta time_step = slab.duration() / 4;
+
+  db::item_type<variables_tag> initial_vars(mesh.number_of_grid_points());
+  for (size_t i = 0; i < mesh.number_of_grid_points(); ++i) {
+    get(get<Tags::ScalarVar>(initial_vars))[i] = pow(i, 5) * 0.5;
+    for (size_t d = 0; d < Dim; ++d) {
+      get<Tags::VectorVar<Dim>>(initial_vars).get(d)[i] =
+          d + pow(i, 5) * 0.75;
+    }
+  }
+  // The time derivatives are twice the variables, so the first substep of
+  // RK3 rescales the variables by 1 + 2 * time_step = 1.5 before filtering
+  db::item_type<dt_variables_tag> dt_vars(mesh.number_of_grid_points());
+  get(get<::Tags::dt<Tags::ScalarVar>>(dt_vars)) =
+      2.0 * get(get<Tags::ScalarVar>(initial_vars));
+  for (size_t d = 0; d < Dim; ++d) {
+    get<::Tags::dt<Tags::VectorVar<Dim>>>(dt_vars).get(d) =
+        2.0 * get<Tags::VectorVar<Dim>>(initial_vars).get(d);
+  }
+  db::item_type<::Tags::HistoryEvolvedVariables<variables_tag>> history{};
+  history.insert(TimeStepId(true, 0, slab.start()), initial_vars, dt_vars);
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner(
+      tuples::TaggedTuple<::Filters::Tags::Filter<Filters::Exponential<0>>,
+                          ::Tags::TimeStepper<TimeStepper>>{
+          Filters::Exponential<0>{alpha, half_power, false},
+          std::make_unique<TimeSteppers::RungeKutta3>()});
+  ActionTesting::emplace_component_and_initialize<component>(
+      &runner, 0, {mesh, time_step, initial_vars, std::move(history)});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           metavariables::Phase::Testing);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+
+  std::array<Matrix, Dim> filter{};
+  for (size_t d = 0; d < Dim; d++) {
+    gsl::at(filter, d) = Spectral::filtering::exponential_filter(
+        mesh.slice_through(d), alpha, half_power);
+  }
+  const auto expected_component = [&filter, &mesh](
+                                      const DataVector& initial_component,
+                                      const bool filtered) noexcept {
+    const DataVector updated_component = 1.5 * initial_component;
+    return filtered ? apply_matrices(filter, updated_component, mesh.extents())
+                    : updated_component;
+  };
+  Scalar<DataVector> expected_scalar{};
+  get(expected_scalar) =
+      expected_component(get(get<Tags::ScalarVar>(initial_vars)),
+                         tmpl::list_contains_v<TagsToFilter, Tags::ScalarVar>);
+  tnsr::I<DataVector, Dim> expected_vector{};
+  for (size_t d = 0; d < Dim; d++) {
+    expected_vector.get(d) = expected_component(
+        get<Tags::VectorVar<Dim>>(initial_vars).get(d),
+        tmpl::list_contains_v<TagsToFilter, Tags::VectorVar<Dim>>);
+  }
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      expected_scalar,
+      (ActionTesting::get_databox_tag<component, Tags::ScalarVar>(runner, 0)),
+      custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      expected_vector,
+      (ActionTesting::get_databox_tag<component, Tags::VectorVar<Dim>>(runner,
+                                                                       0)),
+      custom_approx);
+}
+
+template <size_t Dim>
+void invoke_test_update_u_and_filter(const double alpha,
+                                     const unsigned half_power) noexcept {
+  test_update_u_and_filter<Dim,
+                           tmpl::list<Tags::ScalarVar, Tags::VectorVar<Dim>>>(
+      alpha, half_power);
+  test_update_u_and_filter<Dim, tmpl::list<Tags::ScalarVar>>(alpha,
+                                                              half_power);
+  test_update_u_and_filter<Dim, tmpl::list<Tags::VectorVar<Dim>>>(alpha,
+                                                                   half_power);
+}
+
 template <size_t Dim>
 void test_exponential_filter_creation() noexcept {
   using Filter = Filters::Exponential<0>;
@@ -256,6 +391,10 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.Filter",
   invoke_test_exponential_filter_action<2, false>(alpha, half_power, true);
   invoke_test_exponential_filter_action<3, false>(alpha, half_power, true);
 
+  invoke_test_update_u_and_filter<1>(alpha, half_power);
+  invoke_test_update_u_and_filter<2>(alpha, half_power);
+  invoke_test_update_u_and_filter<3>(alpha, half_power);
+
   test_exponential_filter_creation<1>();
   test_exponential_filter_creation<2>();
   test_exponential_filter_creation<3>();
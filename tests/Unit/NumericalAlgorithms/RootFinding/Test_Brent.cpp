@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Exceptions.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/RootFinding/Brent.hpp"
+#include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+
+namespace {
+void test_datavector() noexcept {
+  /// [lockstep_brent_root_find]
+  const double abs_tol = 1e-15;
+  const double rel_tol = 1e-15;
+  const DataVector lower{0.0, sqrt(2.0) - abs_tol, 1.0, -4.0, 0.0};
+  const DataVector upper{2.0, 2.0, 3.0, 0.0, 3.0};
+  const DataVector constant{2.0, 2.0, 4.0, 4.0, 9.0};
+  size_t number_of_calls = 0;
+  const auto f_lambda = [&constant,
+                         &number_of_calls](const DataVector& x) noexcept {
+    ++number_of_calls;
+    return DataVector{constant - square(x)};
+  };
+  const auto root =
+      RootFinder::lockstep_brent(f_lambda, lower, upper, abs_tol, rel_tol);
+  /// [lockstep_brent_root_find]
+  const DataVector correct{sqrt(2.0), sqrt(2.0), 2.0, -2.0, 3.0};
+  for (size_t s = 0; s < root.size(); ++s) {
+    CHECK(std::abs(root[s] - correct[s]) <
+          2.0 * (abs_tol + rel_tol * std::abs(correct[s])));
+  }
+
+  // Compare with independent scalar solves
+  const auto root_toms748 = RootFinder::toms748(
+      [&constant](const double x, const size_t i) noexcept {
+        return constant[i] - square(x);
+      },
+      lower, upper, abs_tol, rel_tol);
+  CHECK_ITERABLE_APPROX(root, root_toms748);
+
+  // All points share the evaluations, so there are far fewer calls than the
+  // total number of scalar evaluations.
+  CHECK(number_of_calls < 100);
+}
+
+void test_bad_bracket() noexcept {
+  const auto f_lambda = [](const DataVector& x) noexcept {
+    return DataVector{2.0 - square(x)};
+  };
+  test_throw_exception(
+      [&f_lambda]() {
+        RootFinder::lockstep_brent(f_lambda, DataVector{0.0, 0.0},
+                                   DataVector{2.0, 1.0}, 1e-15, 1e-15);
+      },
+      std::domain_error("lockstep_brent: the bounds do not bracket the root "
+                        "at index 1: f(0) = 2, f(1) = 1"));
+}
+
+void test_convergence_error() noexcept {
+  const auto f_lambda = [](const DataVector& x) noexcept {
+    return DataVector{2.0 - square(x)};
+  };
+  test_throw_exception(
+      [&f_lambda]() {
+        RootFinder::lockstep_brent(f_lambda, DataVector{0.0, 1.0},
+                                   DataVector{2.0, 2.0}, 1e-15, 1e-15, 2);
+      },
+      convergence_error("lockstep_brent reached max iterations of 2 without "
+                        "converging at 2 of 2 points."));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.Brent",
+                  "[NumericalAlgorithms][RootFinding][Unit]") {
+  test_datavector();
+  test_bad_bracket();
+  test_convergence_error();
+}
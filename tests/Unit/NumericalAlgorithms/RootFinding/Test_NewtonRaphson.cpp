@@ -97,6 +97,45 @@ void test_datavector() noexcept {
   }
 }
 
+void test_lockstep_datavector() noexcept {
+  /// [lockstep_newton_raphson_root_find]
+  const size_t digits = 8;
+  const DataVector guess{1.6, 1.9, -1.6, -1.9, 1.0};
+  const DataVector lower{sqrt(2.), sqrt(2.), -2., -3., 0.};
+  const DataVector upper{2., 3., -sqrt(2.), -sqrt(2.), 1.5};
+  const DataVector constant{2., 4., 2., 4., 1.};
+
+  const auto func_and_deriv_lambda = [&constant](const DataVector& x) noexcept {
+    return std::make_pair(DataVector{constant - square(x)},
+                          DataVector{-2. * x});
+  };
+
+  const auto root = RootFinder::lockstep_newton_raphson(
+      func_and_deriv_lambda, guess, lower, upper, digits);
+  /// [lockstep_newton_raphson_root_find]
+
+  const DataVector correct{sqrt(2.), 2., -sqrt(2.), -2., 1.};
+  for (size_t i = 0; i < guess.size(); i++) {
+    CHECK(std::abs(root[i] - correct[i]) < 1.0 / std::pow(10, digits));
+  }
+
+  // A guess outside the bracketed region is pulled back into the bounds
+  const auto root_far = RootFinder::lockstep_newton_raphson(
+      func_and_deriv_lambda, DataVector{1.5, 2.9, -1.5, -2.9, 0.01}, lower,
+      upper, digits);
+  for (size_t i = 0; i < guess.size(); i++) {
+    CHECK(std::abs(root_far[i] - correct[i]) < 1.0 / std::pow(10, digits));
+  }
+
+  test_throw_exception(
+      [&func_and_deriv_lambda, &guess, &lower, &upper]() {
+        RootFinder::lockstep_newton_raphson(func_and_deriv_lambda, guess,
+                                            lower, upper, digits, 1);
+      },
+      convergence_error("lockstep_newton_raphson reached max iterations of 1 "
+                        "without converging at 4 of 5 points."));
+}
+
 void test_convergence_error_double() noexcept {
   const size_t max_iterations = 2;
   const size_t digits = 8;
@@ -187,6 +226,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.NewtonRaphson",
   test_simple();
   test_bounds();
   test_datavector();
+  test_lockstep_datavector();
   test_convergence_error_double();
   test_convergence_error_datavector();
 }
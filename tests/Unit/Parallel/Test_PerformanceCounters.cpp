@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/PerformanceCounters.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+struct SomeTag : db::SimpleTag {
+  using type = int;
+};
+
+void test_counters() noexcept {
+  Parallel::PerformanceCounters counters{};
+  for (const auto counter : Parallel::PerformanceCounters::all_counters) {
+    CHECK(counters[counter] == 0);
+  }
+  counters.increment(Parallel::PerformanceCounter::RhsEvaluations);
+  counters.increment(Parallel::PerformanceCounter::MessagesSent, 4);
+  counters.increment(Parallel::PerformanceCounter::MessagesSent, 2);
+  CHECK(counters[Parallel::PerformanceCounter::RhsEvaluations] == 1);
+  CHECK(counters[Parallel::PerformanceCounter::LimiterActivations] == 0);
+  CHECK(counters[Parallel::PerformanceCounter::MessagesSent] == 6);
+
+  CHECK(counters != Parallel::PerformanceCounters{});
+  test_serialization(counters);
+
+  CHECK(get_output(Parallel::PerformanceCounter::RhsEvaluations) ==
+        "RhsEvaluations");
+  CHECK(get_output(Parallel::PerformanceCounter::LimiterActivations) ==
+        "LimiterActivations");
+  CHECK(get_output(Parallel::PerformanceCounter::MessagesSent) ==
+        "MessagesSent");
+}
+
+void test_increment_in_databox() noexcept {
+  auto box = db::create<
+      db::AddSimpleTags<SomeTag, Parallel::Tags::PerformanceCounters>>(
+      1, Parallel::PerformanceCounters{});
+  Parallel::increment_performance_counter(
+      make_not_null(&box), Parallel::PerformanceCounter::LimiterActivations);
+  Parallel::increment_performance_counter(
+      make_not_null(&box), Parallel::PerformanceCounter::LimiterActivations,
+      3);
+  const auto& counters = db::get<Parallel::Tags::PerformanceCounters>(box);
+  CHECK(counters[Parallel::PerformanceCounter::LimiterActivations] == 4);
+  CHECK(counters[Parallel::PerformanceCounter::RhsEvaluations] == 0);
+
+  // Without the counters in the DataBox nothing is counted
+  auto box_without_counters = db::create<db::AddSimpleTags<SomeTag>>(1);
+  Parallel::increment_performance_counter(
+      make_not_null(&box_without_counters),
+      Parallel::PerformanceCounter::RhsEvaluations);
+  CHECK(db::get<SomeTag>(box_without_counters) == 1);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.PerformanceCounters", "[Unit][Parallel]") {
+  test_counters();
+  test_increment_in_databox();
+}
@@ -0,0 +1,27 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <type_traits>
+
+#include "Parallel/PhaseNames.hpp"
+
+namespace {
+struct Metavariables {
+  DEFINE_PHASES(Initialization, RegisterWithObserver, Evolve, Exit)
+};
+
+static_assert(std::is_enum_v<Metavariables::Phase>);
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.PhaseNames", "[Unit][Parallel]") {
+  using Phase = Metavariables::Phase;
+  CHECK(Metavariables::phase_name(Phase::Initialization) == "Initialization");
+  CHECK(Metavariables::phase_name(Phase::RegisterWithObserver) ==
+        "RegisterWithObserver");
+  CHECK(Metavariables::phase_name(Phase::Evolve) == "Evolve");
+  CHECK(Metavariables::phase_name(Phase::Exit) == "Exit");
+  CHECK(static_cast<int>(Phase::Evolve) == 2);
+}
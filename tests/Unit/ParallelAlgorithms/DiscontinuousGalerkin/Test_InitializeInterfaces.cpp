@@ -27,6 +27,7 @@
 #include "Evolution/Initialization/Evolution.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeDomain.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeInterfaces.hpp"
 #include "Time/Slab.hpp"
@@ -150,6 +151,10 @@ void check_compute_items(const ActionTesting::MockRuntimeSystem<
   CHECK(tag_is_retrievable(
       domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<Dim>,
                               other_vars_tag>{}));
+  CHECK(tag_is_retrievable(
+      domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<Dim>,
+                              vars_tag>{}));
+  CHECK(tag_is_retrievable(::Tags::DirichletBoundaryDataCoordinates<Dim>{}));
   CHECK(tag_is_retrievable(
       domain::Tags::Interface<domain::Tags::InternalDirections<Dim>,
                               SomeComputeTag<vars_tag>>{}));
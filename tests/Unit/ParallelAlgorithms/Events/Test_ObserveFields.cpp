@@ -27,6 +27,7 @@
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -180,7 +181,11 @@ struct ScalarSystem {
                                 all_vars_for_test,
                                 solution_for_test::vars_for_test>;
   static constexpr auto creation_string_for_test = "ObserveFields";
-  static ObserveEvent make_test_object() noexcept { return ObserveEvent{}; }
+  static ObserveEvent make_test_object(
+      const size_t observation_grid_points = 0) noexcept {
+    return ObserveEvent{ObserveEvent::VariablesToObserve::default_value(),
+                        observation_grid_points};
+  }
 };
 
 struct ComplicatedSystem {
@@ -273,13 +278,16 @@ struct ComplicatedSystem {
   static constexpr auto creation_string_for_test =
       "ObserveFields:\n"
       "  VariablesToObserve: [Scalar, Vector, Tensor, Tensor2]";
-  static ObserveEvent make_test_object() noexcept {
-    return ObserveEvent({"Scalar", "Vector", "Tensor", "Tensor2"});
+  static ObserveEvent make_test_object(
+      const size_t observation_grid_points = 0) noexcept {
+    return ObserveEvent({"Scalar", "Vector", "Tensor", "Tensor2"},
+                        observation_grid_points);
   }
 };
 
 template <typename System, typename ObserveEvent>
-void test_observe(const std::unique_ptr<ObserveEvent> observe) noexcept {
+void test_observe(const std::unique_ptr<ObserveEvent> observe,
+                  const size_t observation_grid_points = 0) noexcept {
   using metavariables = Metavariables<System>;
   constexpr size_t volume_dim = System::volume_dim;
   using element_component = ElementComponent<metavariables>;
@@ -292,6 +300,12 @@ void test_observe(const std::unique_ptr<ObserveEvent> observe) noexcept {
   const std::string element_name = get_output(element_id);
   const Mesh<volume_dim> mesh(5, Spectral::Basis::Legendre,
                               Spectral::Quadrature::GaussLobatto);
+  const Mesh<volume_dim> observation_mesh =
+      observation_grid_points == 0
+          ? mesh
+          : Mesh<volume_dim>(observation_grid_points, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto);
+  const intrp::RegularGrid<volume_dim> interpolant(mesh, observation_mesh);
   const double observation_time = 2.0;
   Variables<
       tmpl::push_back<typename System::all_vars_for_test, coordinates_tag>>
@@ -342,16 +356,18 @@ void test_observe(const std::unique_ptr<ObserveEvent> observe) noexcept {
             Parallel::ArrayIndex<ElementId<volume_dim>>(array_index)));
   CHECK(results.received_extents.size() == volume_dim);
   CHECK(std::equal(results.received_extents.begin(),
-                   results.received_extents.end(), mesh.extents().begin()));
+                   results.received_extents.end(),
+                   observation_mesh.extents().begin()));
 
   size_t num_components_observed = 0;
   // gcc 6.4.0 gets confused if we try to capture tensor_data by
   // reference and fails to compile because it wants it to be
   // non-const, so we capture a pointer instead.
   const auto check_component = [
-    &element_name, &num_components_observed,
+    &element_name, &num_components_observed, &interpolant,
     tensor_data = &results.in_received_tensor_data
-  ](const std::string& component, const DataVector& expected) noexcept {
+  ](const std::string& component, const DataVector& data) noexcept {
+    const DataVector expected = interpolant.interpolate(data);
     CAPTURE(*tensor_data);
     CAPTURE(component);
     const auto it =
@@ -361,7 +377,7 @@ void test_observe(const std::unique_ptr<ObserveEvent> observe) noexcept {
         });
     CHECK(it != tensor_data->end());
     if (it != tensor_data->end()) {
-      CHECK(it->data == expected);
+      CHECK_ITERABLE_APPROX(it->data, expected);
     }
     ++num_components_observed;
   };
@@ -397,6 +413,24 @@ void test_system() noexcept {
       System::creation_string_for_test);
   auto serialized_event = serialize_and_deserialize(factory_event);
   test_observe<System>(std::move(serialized_event));
+
+  INFO("interpolated to a coarser mesh");
+  test_observe<System>(std::make_unique<typename System::ObserveEvent>(
+                           System::make_test_object(3)),
+                       3);
+  test_observe<System>(std::make_unique<typename System::ObserveEvent>(
+                           serialize_and_deserialize(
+                               System::make_test_object(3))),
+                       3);
+  test_observe<System>(
+      std::make_unique<typename System::ObserveEvent>(
+          TestHelpers::test_creation<typename System::ObserveEvent>(
+              "ObservationGridPoints: 3")),
+      3);
+  // requesting more points than the element has observes the element mesh
+  test_observe<System>(std::make_unique<typename System::ObserveEvent>(
+                           System::make_test_object(8)),
+                       0);
 }
 }  // namespace
 
@@ -420,3 +454,11 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.repeated_field",
   TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
       "VariablesToObserve: [Scalar, Scalar]");
 }
+
+// [[OutputRegex, ObservationGridPoints must be 0.*or at least 2, but is 1]]
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.one_grid_point",
+                  "[Unit][Evolution]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
+      "ObservationGridPoints: 1");
+}
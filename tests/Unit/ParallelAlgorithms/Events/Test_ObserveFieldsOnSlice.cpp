@@ -0,0 +1,362 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/Neighbors.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/Events/ObserveFieldsOnSlice.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+template <size_t>
+class Index;
+namespace Parallel {
+template <typename Metavariables>
+class ConstGlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeVolumeData;
+}  // namespace observers::Actions
+
+namespace {
+struct ObservationTimeTag : db::SimpleTag {
+  using type = double;
+};
+
+struct ScalarVar : db::SimpleTag {
+  static std::string name() noexcept { return "Scalar"; }
+  using type = Scalar<DataVector>;
+};
+
+struct MockContributeVolumeData {
+  struct Results {
+    observers::ObservationId observation_id{};
+    std::string subfile_name{};
+    observers::ArrayComponentId array_component_id{};
+    std::vector<TensorComponent> in_received_tensor_data{};
+    std::vector<size_t> received_extents{};
+  };
+  static Results results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex, size_t Dim>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name,
+                    const observers::ArrayComponentId& array_component_id,
+                    std::vector<TensorComponent>&& in_received_tensor_data,
+                    const Index<Dim>& received_extents) noexcept {
+    results.observation_id = observation_id;
+    results.subfile_name = subfile_name;
+    results.array_component_id = array_component_id;
+    results.in_received_tensor_data = in_received_tensor_data;
+    results.received_extents.assign(received_extents.indices().begin(),
+                                    received_extents.indices().end());
+  }
+};
+
+MockContributeVolumeData::Results MockContributeVolumeData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<2>;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeVolumeData>;
+  using with_these_simple_actions = tmpl::list<MockContributeVolumeData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+  enum class Phase { Initialization, Testing, Exit };
+
+  struct ObservationType {};
+  using element_observation_type = ObservationType;
+};
+
+using ObserveEvent =
+    dg::Events::ObserveFieldsOnSlice<2, ObservationTimeTag,
+                                     tmpl::list<ScalarVar>>;
+using coordinates_tag = domain::Tags::Coordinates<2, Frame::Inertial>;
+
+// The element covers x in [-1, 3] and y in [-3, 3], with x optionally sheared
+// in y so that no logical slice of the element is a plane of constant x.
+tnsr::I<DataVector, 2, Frame::Inertial> inertial_coordinates(
+    const Mesh<2>& mesh, const double shear) noexcept {
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, 2, Frame::Inertial> result{
+      mesh.number_of_grid_points()};
+  get<0>(result) = 1.0 + 2.0 * get<0>(logical_coords) +
+                   shear * get<1>(logical_coords);
+  get<1>(result) = 3.0 * get<1>(logical_coords);
+  return result;
+}
+
+Scalar<DataVector> scalar(
+    const tnsr::I<DataVector, 2, Frame::Inertial>& x) noexcept {
+  return Scalar<DataVector>{square(get<0>(x)) + get<1>(x)};
+}
+
+// Runs the event and checks the data sent to the observer against the data
+// computed at `expected_coordinates`, which are empty if the element is not
+// expected to observe anything. All faces of the element without `neighbors`
+// are external boundaries.
+template <typename ObserveEventType>
+void test_observe(
+    const std::unique_ptr<ObserveEventType> observe, const double shear,
+    const std::optional<tnsr::I<DataVector, 2, Frame::Inertial>>&
+        expected_coordinates,
+    const std::array<size_t, 2>& expected_extents,
+    const std::string& expected_subfile_name = "/slice_data",
+    Element<2>::Neighbors_t neighbors = {}) noexcept {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  const ElementId<2> element_id(0);
+  const std::string element_name = get_output(element_id);
+  const Mesh<2> mesh(4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  const double observation_time = 2.0;
+  const auto coords = inertial_coordinates(mesh, shear);
+  Element<2> element(element_id, std::move(neighbors));
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_component<element_component>(make_not_null(&runner),
+                                                      element_id);
+  ActionTesting::emplace_component<observer_component>(&runner, 0);
+
+  const auto box = db::create<
+      db::AddSimpleTags<ObservationTimeTag, domain::Tags::Mesh<2>,
+                        domain::Tags::Element<2>, coordinates_tag, ScalarVar>>(
+      observation_time, mesh, std::move(element), coords, scalar(coords));
+
+  observe->run(box, runner.cache(), element_id,
+               std::add_pointer_t<element_component>{});
+  runner.invoke_queued_simple_action<observer_component>(0);
+  CHECK(runner.is_simple_action_queue_empty<observer_component>(0));
+
+  const auto& results = MockContributeVolumeData::results;
+  CHECK(results.observation_id.value() == observation_time);
+  CHECK(results.subfile_name == expected_subfile_name);
+  CHECK(results.array_component_id ==
+        observers::ArrayComponentId(
+            std::add_pointer_t<element_component>{},
+            Parallel::ArrayIndex<ElementId<2>>(element_id)));
+  CHECK(results.received_extents ==
+        std::vector<size_t>(expected_extents.begin(), expected_extents.end()));
+
+  if (not expected_coordinates.has_value()) {
+    CHECK(results.in_received_tensor_data.empty());
+    return;
+  }
+  const auto& tensor_data = results.in_received_tensor_data;
+  const auto check_component = [&element_name, &tensor_data](
+                                   const std::string& component,
+                                   const DataVector& expected) noexcept {
+    CAPTURE(component);
+    const auto it = alg::find_if(
+        tensor_data, [name = element_name + "/" + component](
+                         const TensorComponent& tc) noexcept {
+          return tc.name == name;
+        });
+    REQUIRE(it != tensor_data.end());
+    CHECK_ITERABLE_APPROX(it->data, expected);
+  };
+  check_component("InertialCoordinates_x", get<0>(*expected_coordinates));
+  check_component("InertialCoordinates_y", get<1>(*expected_coordinates));
+  check_component("Scalar", get(scalar(*expected_coordinates)));
+  CHECK(tensor_data.size() == 3);
+}
+
+void test_logical_slice() noexcept {
+  const Mesh<2> mesh(4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  const auto coords = inertial_coordinates(mesh, 0.0);
+  const std::unordered_set<Direction<2>> no_external_boundaries{};
+  const auto check = [&mesh](const DataVector& coordinate, const double value,
+                             const size_t expected_dim,
+                             const double expected_logical_coord,
+                             const std::unordered_set<Direction<2>>&
+                                 external_boundaries = {}) noexcept {
+    const auto slice = dg::Events::ObserveFieldsOnSlice_detail::logical_slice(
+        mesh, coordinate, value, external_boundaries);
+    REQUIRE(slice.has_value());
+    CHECK(slice->first == expected_dim);
+    CHECK(slice->second == approx(expected_logical_coord));
+  };
+  check(get<0>(coords), 0.0, 0, -0.5);
+  check(get<0>(coords), -1.0, 0, -1.0);
+  check(get<1>(coords), 1.5, 1, 0.5);
+  // decreasing along the logical coordinate
+  check(DataVector{-get<0>(coords)}, -2.0, 0, 0.5);
+  // the upper face and planes outside the element are not observed
+  using dg::Events::ObserveFieldsOnSlice_detail::logical_slice;
+  CHECK_FALSE(logical_slice(mesh, get<0>(coords), 3.0, no_external_boundaries)
+                  .has_value());
+  CHECK_FALSE(logical_slice(mesh, get<0>(coords), -1.5, no_external_boundaries)
+                  .has_value());
+  CHECK_FALSE(logical_slice(mesh, get<1>(coords), 4.0, no_external_boundaries)
+                  .has_value());
+  CHECK_FALSE(logical_slice(mesh, get<0>(inertial_coordinates(mesh, 0.1)),
+                            1.0, no_external_boundaries)
+                  .has_value());
+  // planes within roundoff of a face are assigned to one element only
+  check(get<0>(coords), -1.0 + 1.0e-15, 0, -1.0);
+  check(get<0>(coords), -1.0 - 1.0e-15, 0, -1.0);
+  CHECK_FALSE(logical_slice(mesh, get<0>(coords), 3.0 - 1.0e-15,
+                            no_external_boundaries)
+                  .has_value());
+  // unless the upper face is an external boundary
+  check(get<0>(coords), 3.0, 0, 1.0, {Direction<2>::upper_xi()});
+  check(get<1>(coords), 3.0, 1, 1.0, {Direction<2>::upper_eta()});
+  check(get<0>(coords), 3.0 - 1.0e-15, 0, 1.0, {Direction<2>::upper_xi()});
+  CHECK_FALSE(logical_slice(mesh, get<0>(coords), 3.0,
+                            {Direction<2>::lower_xi()})
+                  .has_value());
+  // for a decreasing coordinate the lower logical face is the upper face
+  check(DataVector{-get<0>(coords)}, 1.0, 0, -1.0, {Direction<2>::lower_xi()});
+  CHECK_FALSE(logical_slice(mesh, DataVector{-get<0>(coords)}, 1.0,
+                            {Direction<2>::upper_xi()})
+                  .has_value());
+}
+
+void test_event() noexcept {
+  const Mesh<1> mesh_1d(4, Spectral::Basis::Legendre,
+                        Spectral::Quadrature::GaussLobatto);
+  const DataVector collocation_points = Spectral::collocation_points(mesh_1d);
+
+  // the plane x = 0 is at xi = -0.5
+  tnsr::I<DataVector, 2, Frame::Inertial> x_slice{4};
+  get<0>(x_slice) = 0.0;
+  get<1>(x_slice) = 3.0 * collocation_points;
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 0, 0.0}),
+               0.0, x_slice, {{1, 4}});
+
+  // the plane y = 1.5 is at eta = 0.5
+  tnsr::I<DataVector, 2, Frame::Inertial> y_slice{4};
+  get<0>(y_slice) = 1.0 + 2.0 * collocation_points;
+  get<1>(y_slice) = 1.5;
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 1, 1.5}),
+               0.0, y_slice, {{4, 1}});
+  test_observe(std::make_unique<ObserveEvent>(serialize_and_deserialize(
+                   ObserveEvent{"slice_data", {"Scalar"}, 1, 1.5})),
+               0.0, y_slice, {{4, 1}});
+
+  // elements the plane misses still contribute, but without data
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 0, 5.0}),
+               0.0, std::nullopt, {{4, 4}});
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 0, 0.0}),
+               0.1, std::nullopt, {{4, 4}});
+
+  // the plane x = 3 on the upper xi face is observed if the face is an
+  // external boundary, and by the neighbor otherwise
+  tnsr::I<DataVector, 2, Frame::Inertial> upper_x_slice{4};
+  get<0>(upper_x_slice) = 3.0;
+  get<1>(upper_x_slice) = 3.0 * collocation_points;
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 0, 3.0}),
+               0.0, upper_x_slice, {{1, 4}});
+  Element<2>::Neighbors_t upper_xi_neighbor{};
+  upper_xi_neighbor.emplace(Direction<2>::upper_xi(),
+                            Neighbors<2>{{ElementId<2>{1}}, {}});
+  test_observe(std::make_unique<ObserveEvent>(
+                   ObserveEvent{"slice_data", {"Scalar"}, 0, 3.0}),
+               0.0, std::nullopt, {{4, 4}}, "/slice_data",
+               std::move(upper_xi_neighbor));
+
+  INFO("create/serialize");
+  using EventType =
+      Event<tmpl::list<dg::Events::Registrars::ObserveFieldsOnSlice<
+          2, ObservationTimeTag, tmpl::list<ScalarVar>>>>;
+  Parallel::register_derived_classes_with_charm<EventType>();
+  const auto factory_event = TestHelpers::test_factory_creation<EventType>(
+      "ObserveFieldsOnSlice:\n"
+      "  SubfileName: equatorial_plane\n"
+      "  VariablesToObserve: [Scalar]\n"
+      "  SliceDimension: 0\n"
+      "  SliceCoordinate: 0.0");
+  auto serialized_event = serialize_and_deserialize(factory_event);
+  test_observe(std::move(serialized_event), 0.0, x_slice, {{1, 4}},
+               "/equatorial_plane");
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFieldsOnSlice",
+                  "[Unit][Evolution]") {
+  test_logical_slice();
+  test_event();
+}
+
+// [[OutputRegex, NotAVar is not an available variable.*Scalar]]
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFieldsOnSlice.bad_field",
+                  "[Unit][Evolution]") {
+  ERROR_TEST();
+  TestHelpers::test_creation<ObserveEvent>(
+      "VariablesToObserve: [NotAVar]\n"
+      "SliceDimension: 0\n"
+      "SliceCoordinate: 0.0");
+}
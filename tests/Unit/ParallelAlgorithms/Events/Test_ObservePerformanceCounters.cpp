@@ -0,0 +1,209 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/PerformanceCounters.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/Events/ObservePerformanceCounters.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class ConstGlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+
+struct ObservationTimeTag : db::SimpleTag {
+  using type = double;
+};
+
+struct MockContributeReductionData {
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names{};
+    double time;
+    size_t number_of_elements;
+    size_t number_of_points;
+    double wall_time;
+    std::vector<double> counter_data{};
+  };
+  static Results results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex, typename... Ts>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    Parallel::ReductionData<Ts...>&& reduction_data) noexcept {
+    results.observation_id = observation_id;
+    results.subfile_name = subfile_name;
+    results.reduction_names = reduction_names;
+    results.time = std::get<0>(reduction_data.data());
+    results.number_of_elements = std::get<1>(reduction_data.data());
+    results.number_of_points = std::get<2>(reduction_data.data());
+    results.wall_time = std::get<3>(reduction_data.data());
+
+    // The mean over a single element is its count
+    reduction_data.finalize();
+    results.counter_data.clear();
+    tmpl::for_each<tmpl::range<size_t, 4, sizeof...(Ts)>>(
+        [&reduction_data](auto index_v) noexcept {
+          constexpr size_t index = tmpl::type_from<decltype(index_v)>::value;
+          results.counter_data.push_back(
+              std::get<index>(reduction_data.data()));
+        });
+  }
+};
+
+MockContributeReductionData::Results MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockArrayChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockArrayChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;  //  unused
+  enum class Phase { Initialization, Testing, Exit };
+
+  struct ObservationType {};
+  using element_observation_type = ObservationType;
+};
+
+template <size_t VolumeDim, typename ObserveEvent>
+void test_observe(const std::unique_ptr<ObserveEvent> observe) noexcept {
+  using metavariables = Metavariables;
+  using element_component = ElementComponent<metavariables>;
+  using observer_component = MockObserverComponent<metavariables>;
+
+  const typename element_component::array_index array_index(0);
+
+  const Mesh<VolumeDim> mesh{5, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto};
+  Parallel::PerformanceCounters counters{};
+  counters.increment(Parallel::PerformanceCounter::RhsEvaluations, 3);
+  counters.increment(Parallel::PerformanceCounter::LimiterActivations);
+  counters.increment(Parallel::PerformanceCounter::MessagesSent, 12);
+
+  const double observation_time = 2.0;
+  const auto box = db::create<
+      db::AddSimpleTags<ObservationTimeTag, domain::Tags::Mesh<VolumeDim>,
+                        Parallel::Tags::PerformanceCounters>>(
+      observation_time, mesh, counters);
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner{{}};
+  ActionTesting::emplace_component<element_component>(make_not_null(&runner),
+                                                      0);
+  ActionTesting::emplace_component<observer_component>(&runner, 0);
+
+  observe->run(box, runner.cache(), array_index,
+               std::add_pointer_t<element_component>{});
+
+  // Process the data
+  runner.invoke_queued_simple_action<observer_component>(0);
+  CHECK(runner.is_simple_action_queue_empty<observer_component>(0));
+
+  const auto& results = MockContributeReductionData::results;
+  CHECK(results.observation_id.value() == observation_time);
+  CHECK(results.subfile_name == "/performance_counters");
+  CHECK(results.reduction_names ==
+        std::vector<std::string>{
+            db::tag_name<ObservationTimeTag>(), "NumberOfElements",
+            "NumberOfPoints", "WallTime", "Min(RhsEvaluations)",
+            "Max(RhsEvaluations)", "Mean(RhsEvaluations)",
+            "Min(LimiterActivations)", "Max(LimiterActivations)",
+            "Mean(LimiterActivations)", "Min(MessagesSent)",
+            "Max(MessagesSent)", "Mean(MessagesSent)"});
+  CHECK(results.time == observation_time);
+  CHECK(results.number_of_elements == 1);
+  CHECK(results.number_of_points == mesh.number_of_grid_points());
+  CHECK(results.wall_time >= 0.0);
+  CHECK(results.counter_data ==
+        std::vector<double>{3.0, 3.0, 3.0, 1.0, 1.0, 1.0, 12.0, 12.0, 12.0});
+}
+
+template <size_t VolumeDim>
+void test_observe_system() noexcept {
+  {
+    INFO("Testing observation for Dim = " << VolumeDim);
+    test_observe<VolumeDim>(
+        std::make_unique<dg::Events::ObservePerformanceCounters<
+            VolumeDim, ObservationTimeTag>>());
+  }
+  {
+    INFO("Testing create/serialize for Dim = " << VolumeDim);
+    using EventType =
+        Event<tmpl::list<dg::Events::Registrars::ObservePerformanceCounters<
+            VolumeDim, ObservationTimeTag>>>;
+    Parallel::register_derived_classes_with_charm<EventType>();
+    const auto factory_event =
+        TestHelpers::test_factory_creation<EventType>(
+            "ObservePerformanceCounters");
+    auto serialized_event = serialize_and_deserialize(factory_event);
+    test_observe<VolumeDim>(std::move(serialized_event));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObservePerformanceCounters",
+                  "[Unit][Evolution]") {
+  test_observe_system<1>();
+  test_observe_system<2>();
+  test_observe_system<3>();
+}
@@ -0,0 +1,209 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class ConstGlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+
+struct ObservationTimeTag : db::SimpleTag {
+  using type = double;
+};
+
+struct MockContributeReductionData {
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names{};
+    double time;
+    size_t number_of_points;
+    double slab_size;
+    double minimum_time_step;
+    double maximum_time_step;
+    double inverse_time_step_sum;
+  };
+  static Results results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex, typename... Ts>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    Parallel::ReductionData<Ts...>&& reduction_data) noexcept {
+    results.observation_id = observation_id;
+    results.subfile_name = subfile_name;
+    results.reduction_names = reduction_names;
+    results.time = std::get<0>(reduction_data.data());
+    results.number_of_points = std::get<1>(reduction_data.data());
+    results.slab_size = std::get<2>(reduction_data.data());
+    results.minimum_time_step = std::get<3>(reduction_data.data());
+    results.maximum_time_step = std::get<4>(reduction_data.data());
+    results.inverse_time_step_sum = std::get<5>(reduction_data.data());
+
+    // Check that the effective time step is recovered from the finalized
+    // reduction of a single element.
+    reduction_data.finalize();
+    CHECK(std::get<5>(reduction_data.data()) ==
+          approx(results.minimum_time_step));
+  }
+};
+
+MockContributeReductionData::Results MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockArrayChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using array_index = int;
+  using chare_type = ActionTesting::MockArrayChare;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;  //  unused
+  enum class Phase { Initialization, Testing, Exit };
+
+  struct ObservationType {};
+  using element_observation_type = ObservationType;
+};
+
+template <size_t VolumeDim, typename ObserveEvent>
+void test_observe(const std::unique_ptr<ObserveEvent> observe,
+                  const bool time_runs_forward) noexcept {
+  using metavariables = Metavariables;
+  using element_component = ElementComponent<metavariables>;
+  using observer_component = MockObserverComponent<metavariables>;
+
+  const typename element_component::array_index array_index(0);
+
+  const Mesh<VolumeDim> mesh{5, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto};
+  const Slab slab(1.0, 3.0);
+  const TimeDelta time_step = time_runs_forward ? slab.duration() / 8
+                                                : -slab.duration() / 8;
+
+  const double observation_time = 2.0;
+  const auto box = db::create<db::AddSimpleTags<
+      ObservationTimeTag, Tags::TimeStep, domain::Tags::Mesh<VolumeDim>>>(
+      observation_time, time_step, mesh);
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner{{}};
+  ActionTesting::emplace_component<element_component>(make_not_null(&runner),
+                                                      0);
+  ActionTesting::emplace_component<observer_component>(&runner, 0);
+
+  observe->run(box, runner.cache(), array_index,
+               std::add_pointer_t<element_component>{});
+
+  // Process the data
+  runner.invoke_queued_simple_action<observer_component>(0);
+  CHECK(runner.is_simple_action_queue_empty<observer_component>(0));
+
+  const auto& results = MockContributeReductionData::results;
+  CHECK(results.observation_id.value() == observation_time);
+  CHECK(results.subfile_name == "/time_steps");
+  CHECK(results.reduction_names ==
+        std::vector<std::string>{db::tag_name<ObservationTimeTag>(),
+                                 "NumberOfPoints", "SlabSize",
+                                 "MinimumTimeStep", "MaximumTimeStep",
+                                 "EffectiveTimeStep"});
+  CHECK(results.time == observation_time);
+  CHECK(results.number_of_points == mesh.number_of_grid_points());
+  CHECK(results.slab_size == 2.0);
+  CHECK(results.minimum_time_step == 0.25);
+  CHECK(results.maximum_time_step == 0.25);
+  CHECK(results.inverse_time_step_sum ==
+        approx(static_cast<double>(mesh.number_of_grid_points()) / 0.25));
+}
+
+template <size_t VolumeDim>
+void test_observe_system() noexcept {
+  {
+    INFO("Testing observation for Dim = " << VolumeDim);
+    test_observe<VolumeDim>(
+        std::make_unique<
+            dg::Events::ObserveTimeStep<VolumeDim, ObservationTimeTag>>(),
+        true);
+    test_observe<VolumeDim>(
+        std::make_unique<
+            dg::Events::ObserveTimeStep<VolumeDim, ObservationTimeTag>>(),
+        false);
+  }
+  {
+    INFO("Testing create/serialize for Dim = " << VolumeDim);
+    using EventType = Event<tmpl::list<
+        dg::Events::Registrars::ObserveTimeStep<VolumeDim, ObservationTimeTag>>>;
+    Parallel::register_derived_classes_with_charm<EventType>();
+    const auto factory_event =
+        TestHelpers::test_factory_creation<EventType>("ObserveTimeStep");
+    auto serialized_event = serialize_and_deserialize(factory_event);
+    test_observe<VolumeDim>(std::move(serialized_event), true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveTimeStep", "[Unit][Evolution]") {
+  test_observe_system<1>();
+  test_observe_system<2>();
+  test_observe_system<3>();
+}
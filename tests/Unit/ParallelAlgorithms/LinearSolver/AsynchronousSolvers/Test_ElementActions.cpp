@@ -16,6 +16,7 @@
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "ParallelAlgorithms/Actions/SetData.hpp"
 #include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
@@ -95,9 +96,10 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
   }
 
   const size_t num_iterations = 1;
+  const size_t reduction_buffer_size = 0;
   ActionTesting::MockRuntimeSystem<Metavariables> runner{
-      {reduction_file_name, volume_file_name, num_iterations,
-       Verbosity::Verbose}};
+      {reduction_file_name, volume_file_name, reduction_buffer_size,
+       num_iterations, Verbosity::Verbose}};
 
   // Setup mock element array
   const int element_id = 0;
@@ -186,6 +188,11 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
 
   {
     INFO("Reduction observations");
+    // Write any buffered reduction data to disk, as is done at the start of
+    // every phase
+    ActionTesting::threaded_action<
+        obs_writer, observers::ThreadedActions::WriteBufferedReductionData>(
+        make_not_null(&runner), 0);
     REQUIRE(file_system::check_if_file_exists(reduction_file_name + ".h5"));
     {
       const auto reductions_file =
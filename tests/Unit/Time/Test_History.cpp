@@ -163,6 +163,51 @@ SPECTRE_TEST_CASE("Unit.Time.History", "[Unit][Time]") {
   check_iterator(copy.begin() + 1);
 }
 
+SPECTRE_TEST_CASE("Unit.Time.History.MarkValuesUnneeded", "[Unit][Time]") {
+  TimeSteppers::History<std::vector<double>, double> history;
+  for (size_t i = 0; i < 3; ++i) {
+    const auto entry_num = static_cast<double>(i);
+    history.insert(make_time_id(entry_num), std::vector<double>(4, entry_num),
+                   entry_num);
+  }
+
+  // Use the history the way a time stepper keeping three entries and
+  // only the most recent value would, so the entries are reused as a
+  // ring buffer
+  for (size_t step = 3; step < 10; ++step) {
+    CAPTURE(step);
+    history.mark_unneeded(history.begin() + 1);
+    history.mark_values_unneeded(history.end() - 1);
+    const auto step_num = static_cast<double>(step);
+    history.insert(make_time_id(step_num), std::vector<double>(4, step_num),
+                   step_num);
+    CHECK(history.size() == 3);
+    CHECK(history.capacity() == 3);
+    auto it = history.begin();
+    for (size_t i = 0; i < 3; ++i, ++it) {
+      const auto entry_num = static_cast<double>(step + i) - 2.0;
+      CHECK(*it == history[i]);
+      CHECK(*it == make_time(entry_num));
+      CHECK(it.time_step_id() == make_time_id(entry_num));
+      CHECK(it.derivative() == entry_num);
+    }
+    CHECK(it == history.end());
+    CHECK(history.back() == make_time(step_num));
+    CHECK(history.begin().value().empty());
+    CHECK((history.begin() + 1).value() ==
+          std::vector<double>(4, step_num - 1.0));
+    CHECK((history.begin() + 2).value() == std::vector<double>(4, step_num));
+  }
+
+  const auto copy = serialize_and_deserialize(history);
+  CHECK(copy.size() == 3);
+  CHECK(copy.capacity() == 3);
+  CHECK(copy.front() == make_time(7.0));
+  CHECK(copy.begin().value().empty());
+  CHECK((copy.begin() + 1).derivative() == 8.0);
+  CHECK((copy.begin() + 2).value() == std::vector<double>(4, 9.0));
+}
+
 namespace {
 using BoundaryHistoryType =
     TimeSteppers::BoundaryHistory<std::string, std::vector<int>, double>;
@@ -301,4 +346,32 @@ SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
   CHECK(check_boundary_state(&copy) == 0);
   check_iterator(copy.local_begin() + 1);
   check_iterator(copy.remote_begin() + 2);
+
+  {
+    INFO("Copying preserves the coupling cache");
+    auto copy_of_copy = copy;
+    CHECK(check_boundary_state(&copy_of_copy) == 0);
+  }
+  {
+    INFO("Removing entries preserves unrelated cached couplings");
+    size_t coupling_calls = 0;
+    const auto coupling = [&coupling_calls](
+        const std::string& /*local*/,
+        const std::vector<int>& /*remote*/) noexcept {
+      ++coupling_calls;
+      return 1.5;
+    };
+    copy.local_mark_unneeded(copy.local_begin() + 1);
+    copy.remote_mark_unneeded(copy.remote_begin() + 1);
+    // Entry pair (2., 0.) was cached by check_boundary_state
+    CHECK(6.5 ==
+          copy.coupling(coupling, copy.local_begin() + 2,
+                        copy.remote_begin() + 1));
+    CHECK(coupling_calls == 0);
+    // Entry pair (-1., -2.) was removed, so it must not be found for
+    // the new first entries.
+    CHECK(1.5 ==
+          copy.coupling(coupling, copy.local_begin(), copy.remote_begin()));
+    CHECK(coupling_calls == 1);
+  }
 }